@@ -0,0 +1,306 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <Core/SIMD.h>
+#include <Animation/Pose.h>
+#include <Vectors/Vector3.h>
+#include <Rotations/Quaternion.h>
+
+/**
+ * @file AnimationClip.h
+ * @brief Keyframe clips with packed SoA tracks, cursor-cached key lookup and
+ *        batched sampling of many instances.
+ */
+
+namespace EU {
+
+    /**
+     * @class AnimationCursor
+     * @brief Per-instance cache of the last key segment used on every track, so
+     *        playback moving forward finds the next segment in O(1).
+     */
+    class
+        AnimationCursor {
+    public:
+        AnimationCursor() {}
+
+        explicit AnimationCursor(int jointCount) {
+            resize(jointCount);
+        }
+
+        void
+            resize(int jointCount) {
+            for (int c = 0; c < 3; ++c) key[c].assign(jointCount, 0);
+        }
+
+        /**
+         * @brief Forgets the cached segments (e.g. after switching clips).
+         */
+        void
+            reset() {
+            for (int c = 0; c < 3; ++c) std::fill(key[c].begin(), key[c].end(), 0);
+        }
+
+        std::vector<int> key[3];        ///< Segment index per joint for translation, rotation, scale.
+    };
+
+    /**
+     * @class AnimationClip
+     * @brief Translation, rotation and scale tracks for every joint of a skeleton.
+     *
+     * Keys are added per joint with addTranslationKey() etc., then build() sorts each
+     * track by time and packs all tracks of a channel into shared SoA arrays (one
+     * time stream plus one stream per component). Joints without keys in a channel
+     * keep the identity value. Translation and scale are interpolated linearly,
+     * rotation with a shortest-arc normalized lerp.
+     */
+    class
+        AnimationClip {
+    public:
+        /**
+         * @brief Channels of a joint.
+         */
+        enum
+            Channel {
+            TRANSLATION,
+            ROTATION,
+            SCALE,
+            CHANNEL_COUNT
+        };
+
+        AnimationClip() : m_duration(0.f), m_jointCount(0) {}
+
+        /**
+         * @brief Creates an empty clip.
+         * @param jointCount Number of joints of the target skeleton.
+         */
+        explicit AnimationClip(int jointCount) : m_duration(0.f), m_jointCount(jointCount) {
+            for (int c = 0; c < CHANNEL_COUNT; ++c) m_pending[c].resize(jointCount);
+        }
+
+        int
+            jointCount() const {
+            return m_jointCount;
+        }
+
+        /**
+         * @brief Time of the last key of any track.
+         */
+        float
+            duration() const {
+            return m_duration;
+        }
+
+        void
+            addTranslationKey(int joint, float time, const CVector3& t) {
+            PendingKey k = { time, { t.x, t.y, t.z, 0.f } };
+            m_pending[TRANSLATION][joint].push_back(k);
+        }
+
+        void
+            addRotationKey(int joint, float time, const Quaternion& r) {
+            PendingKey k = { time, { r.x, r.y, r.z, r.w } };
+            m_pending[ROTATION][joint].push_back(k);
+        }
+
+        void
+            addScaleKey(int joint, float time, const CVector3& s) {
+            PendingKey k = { time, { s.x, s.y, s.z, 0.f } };
+            m_pending[SCALE][joint].push_back(k);
+        }
+
+        /**
+         * @brief Sorts and packs the keys added so far. Must be called before sampling;
+         *        calling it again after adding keys rebuilds the clip.
+         */
+        void
+            build() {
+            m_duration = 0.f;
+            for (int c = 0; c < CHANNEL_COUNT; ++c) {
+                Packed& p = m_channels[c];
+                p.times.clear();
+                for (int k = 0; k < 4; ++k) p.values[k].clear();
+                p.first.assign(m_jointCount, 0);
+                p.count.assign(m_jointCount, 0);
+                const int components = c == ROTATION ? 4 : 3;
+                for (int j = 0; j < m_jointCount; ++j) {
+                    std::vector<PendingKey>& keys = m_pending[c][j];
+                    std::stable_sort(keys.begin(), keys.end(),
+                                     [](const PendingKey& a, const PendingKey& b) { return a.time < b.time; });
+                    p.first[j] = static_cast<int>(p.times.size());
+                    p.count[j] = static_cast<int>(keys.size());
+                    for (const PendingKey& key : keys) {
+                        p.times.push_back(key.time);
+                        for (int k = 0; k < components; ++k) p.values[k].push_back(key.value[k]);
+                        if (key.time > m_duration) m_duration = key.time;
+                    }
+                }
+            }
+        }
+
+        /**
+         * @brief Samples one instance into a pose.
+         * @param time Clip time; clamped to [0, duration()].
+         * @param cursor Cache of this instance, sized to jointCount().
+         * @param pose Output pose, sized to jointCount().
+         */
+        void
+            sample(float time, AnimationCursor& cursor, Pose& pose) const {
+            for (int c = 0; c < CHANNEL_COUNT; ++c) {
+                const Packed& p = m_channels[c];
+                const int components = c == ROTATION ? 4 : 3;
+                const int stream = firstStream(c);
+                for (int j = 0; j < m_jointCount; ++j) {
+                    const int count = p.count[j];
+                    if (count == 0) continue;
+                    float value[4];
+                    evaluate(p, c, j, findSegment(p, j, time, cursor.key[c][j]), time, value);
+                    for (int k = 0; k < components; ++k) pose.stream(static_cast<Pose::Stream>(stream + k))[j] = value[k];
+                }
+            }
+        }
+
+        /**
+         * @brief Samples many instances of this clip at their own times.
+         *
+         * Joints are the outer loop so each track's keys stay in cache while every
+         * instance reads them, and instances are interpolated four at a time. For
+         * crowds, split [0, count) across threads with JobSystem::parallel_for.
+         *
+         * @param times Clip time of each instance.
+         * @param cursors Cache of each instance.
+         * @param poses Output pose of each instance.
+         * @param count Number of instances.
+         */
+        void
+            sampleBatch(const float* times, AnimationCursor* cursors, Pose* poses, int count) const {
+            using SIMD::float4;
+            for (int c = 0; c < CHANNEL_COUNT; ++c) {
+                const Packed& p = m_channels[c];
+                const int components = c == ROTATION ? 4 : 3;
+                const int stream = firstStream(c);
+                for (int j = 0; j < m_jointCount; ++j) {
+                    if (p.count[j] == 0) continue;
+                    int i = 0;
+                    for (; i + SIMD::LANES <= count; i += SIMD::LANES) {
+                        alignas(16) float a[4][SIMD::LANES], b[4][SIMD::LANES], t[SIMD::LANES];
+                        for (int l = 0; l < SIMD::LANES; ++l) {
+                            const float time = times[i + l];
+                            const int seg = findSegment(p, j, time, cursors[i + l].key[c][j]);
+                            const int k0 = p.first[j] + seg;
+                            const int k1 = seg + 1 < p.count[j] ? k0 + 1 : k0;
+                            t[l] = segmentFactor(p, k0, k1, time);
+                            for (int k = 0; k < components; ++k) {
+                                a[k][l] = p.values[k][k0];
+                                b[k][l] = p.values[k][k1];
+                            }
+                        }
+                        const float4 tt = float4::load(t);
+                        float4 r[4];
+                        if (c == ROTATION) {
+                            PoseBlend::nlerp(float4::load(a[0]), float4::load(a[1]), float4::load(a[2]), float4::load(a[3]),
+                                             float4::load(b[0]), float4::load(b[1]), float4::load(b[2]), float4::load(b[3]),
+                                             tt, r[0], r[1], r[2], r[3]);
+                        }
+                        else {
+                            for (int k = 0; k < 3; ++k) {
+                                const float4 va = float4::load(a[k]);
+                                r[k] = madd(float4::load(b[k]) - va, tt, va);
+                            }
+                        }
+                        for (int k = 0; k < components; ++k) {
+                            alignas(16) float out[SIMD::LANES];
+                            r[k].store(out);
+                            for (int l = 0; l < SIMD::LANES; ++l) {
+                                poses[i + l].stream(static_cast<Pose::Stream>(stream + k))[j] = out[l];
+                            }
+                        }
+                    }
+                    for (; i < count; ++i) {
+                        float value[4];
+                        evaluate(p, c, j, findSegment(p, j, times[i], cursors[i].key[c][j]), times[i], value);
+                        for (int k = 0; k < components; ++k) poses[i].stream(static_cast<Pose::Stream>(stream + k))[j] = value[k];
+                    }
+                }
+            }
+        }
+
+    private:
+        struct
+            PendingKey {
+            float time;
+            float value[4];
+        };
+
+        struct
+            Packed {
+            std::vector<float> times;
+            std::vector<float> values[4];
+            std::vector<int> first;     ///< First key of each joint's track.
+            std::vector<int> count;     ///< Key count of each joint's track.
+        };
+
+        static int
+            firstStream(int channel) {
+            return channel == TRANSLATION ? Pose::TX : (channel == ROTATION ? Pose::RX : Pose::SX);
+        }
+
+        /**
+         * @brief Finds the segment [key s, key s + 1] containing time, starting from the
+         *        cached one. Forward playback advances a few keys at most; only seeks
+         *        fall back to a binary search.
+         */
+        static int
+            findSegment(const Packed& p, int joint, float time, int& cached) {
+            const float* times = p.times.data() + p.first[joint];
+            const int count = p.count[joint];
+            if (count < 2 || time <= times[0]) return cached = 0;
+            if (time >= times[count - 1]) return cached = count - 1;
+            int s = cached < count - 1 ? cached : count - 2;
+            if (times[s] <= time) {
+                for (int step = 0; step < 4; ++step) {
+                    if (time < times[s + 1]) return cached = s;
+                    ++s;
+                }
+            }
+            s = static_cast<int>(std::upper_bound(times, times + count, time) - times) - 1;
+            return cached = s;
+        }
+
+        static float
+            segmentFactor(const Packed& p, int k0, int k1, float time) {
+            const float span = p.times[k1] - p.times[k0];
+            if (span <= 0.f) return 0.f;
+            const float t = (time - p.times[k0]) / span;
+            return t < 0.f ? 0.f : (t > 1.f ? 1.f : t);
+        }
+
+        static void
+            evaluate(const Packed& p, int channel, int joint, int seg, float time, float value[4]) {
+            const int k0 = p.first[joint] + seg;
+            const int k1 = seg + 1 < p.count[joint] ? k0 + 1 : k0;
+            const float t = segmentFactor(p, k0, k1, time);
+            if (channel != ROTATION) {
+                for (int k = 0; k < 3; ++k) value[k] = p.values[k][k0] + (p.values[k][k1] - p.values[k][k0]) * t;
+                return;
+            }
+            float dot = 0.f;
+            for (int k = 0; k < 4; ++k) dot += p.values[k][k0] * p.values[k][k1];
+            const float sign = dot < 0.f ? -1.f : 1.f;
+            float lenSq = 0.f;
+            for (int k = 0; k < 4; ++k) {
+                value[k] = p.values[k][k0] + (sign * p.values[k][k1] - p.values[k][k0]) * t;
+                lenSq += value[k] * value[k];
+            }
+            const float invLen = lenSq > 0.f ? 1.f / Math::sqrt(lenSq) : 0.f;
+            for (int k = 0; k < 4; ++k) value[k] *= invLen;
+        }
+
+        Packed m_channels[CHANNEL_COUNT];
+        std::vector<std::vector<PendingKey>> m_pending[CHANNEL_COUNT];
+        float m_duration;
+        int m_jointCount;
+    };
+
+} // namespace EU
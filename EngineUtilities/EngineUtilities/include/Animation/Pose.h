@@ -0,0 +1,258 @@
+#pragma once
+
+#include <vector>
+#include <Core/SIMD.h>
+#include <Vectors/Vector3.h>
+#include <Rotations/Quaternion.h>
+
+/**
+ * @file Pose.h
+ * @brief Local joint transforms of a skeleton in SoA form, plus layered and
+ *        additive blending.
+ */
+
+namespace EU {
+
+    /**
+     * @class Pose
+     * @brief Translation, rotation and scale of every joint, one float stream per
+     *        component. Streams are padded to SIMD::LANES with identity joints so the
+     *        blending kernels always work on whole registers.
+     */
+    class
+        Pose {
+    public:
+        /**
+         * @brief Index of each float stream.
+         */
+        enum
+            Stream {
+            TX, TY, TZ,                 ///< Translation.
+            RX, RY, RZ, RW,             ///< Rotation (unit quaternion).
+            SX, SY, SZ,                 ///< Scale.
+            STREAM_COUNT
+        };
+
+        Pose() : m_jointCount(0) {}
+
+        /**
+         * @brief Creates a pose with every joint at identity.
+         */
+        explicit Pose(int jointCount) : m_jointCount(0) {
+            resize(jointCount);
+        }
+
+        /**
+         * @brief Changes the joint count and resets every joint to identity.
+         */
+        void
+            resize(int jointCount) {
+            m_jointCount = jointCount;
+            const std::size_t padded = static_cast<std::size_t>((jointCount + SIMD::LANES - 1) / SIMD::LANES * SIMD::LANES);
+            for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s].assign(padded, identityValue(s));
+        }
+
+        /**
+         * @brief Resets every joint to identity.
+         */
+        void
+            setIdentity() {
+            for (int s = 0; s < STREAM_COUNT; ++s) {
+                for (float& v : m_streams[s]) v = identityValue(s);
+            }
+        }
+
+        int
+            jointCount() const {
+            return m_jointCount;
+        }
+
+        /**
+         * @brief Number of floats per stream (jointCount() rounded up to SIMD::LANES).
+         */
+        int
+            paddedCount() const {
+            return static_cast<int>(m_streams[TX].size());
+        }
+
+        float*
+            stream(Stream s) {
+            return m_streams[s].data();
+        }
+
+        const float*
+            stream(Stream s) const {
+            return m_streams[s].data();
+        }
+
+        CVector3
+            translation(int joint) const {
+            return CVector3(m_streams[TX][joint], m_streams[TY][joint], m_streams[TZ][joint]);
+        }
+
+        Quaternion
+            rotation(int joint) const {
+            return Quaternion(m_streams[RX][joint], m_streams[RY][joint], m_streams[RZ][joint], m_streams[RW][joint]);
+        }
+
+        CVector3
+            scale(int joint) const {
+            return CVector3(m_streams[SX][joint], m_streams[SY][joint], m_streams[SZ][joint]);
+        }
+
+        void
+            setTranslation(int joint, const CVector3& t) {
+            m_streams[TX][joint] = t.x; m_streams[TY][joint] = t.y; m_streams[TZ][joint] = t.z;
+        }
+
+        void
+            setRotation(int joint, const Quaternion& r) {
+            m_streams[RX][joint] = r.x; m_streams[RY][joint] = r.y;
+            m_streams[RZ][joint] = r.z; m_streams[RW][joint] = r.w;
+        }
+
+        void
+            setScale(int joint, const CVector3& s) {
+            m_streams[SX][joint] = s.x; m_streams[SY][joint] = s.y; m_streams[SZ][joint] = s.z;
+        }
+
+        /**
+         * @brief Value of a stream for the identity transform.
+         */
+        static float
+            identityValue(int stream) {
+            return (stream == RW || stream >= SX) ? 1.f : 0.f;
+        }
+
+    private:
+        std::vector<float> m_streams[STREAM_COUNT];
+        int m_jointCount;
+    };
+
+    namespace PoseBlend {
+
+        /**
+         * @brief Normalized lerp of four quaternions along the shortest arc.
+         */
+        inline void
+            nlerp(const SIMD::float4& ax, const SIMD::float4& ay, const SIMD::float4& az, const SIMD::float4& aw,
+                  SIMD::float4 bx, SIMD::float4 by, SIMD::float4 bz, SIMD::float4 bw, const SIMD::float4& t,
+                  SIMD::float4& rx, SIMD::float4& ry, SIMD::float4& rz, SIMD::float4& rw) {
+            using SIMD::float4;
+            const float4 dot = madd(ax, bx, madd(ay, by, madd(az, bz, aw * bw)));
+            const float4 flip = dot < float4::zero();
+            const float4 signBit(-0.f);
+            // Negate b where the quaternions lie in opposite hemispheres.
+            bx = bx ^ (signBit & flip); by = by ^ (signBit & flip);
+            bz = bz ^ (signBit & flip); bw = bw ^ (signBit & flip);
+            rx = madd(bx - ax, t, ax);
+            ry = madd(by - ay, t, ay);
+            rz = madd(bz - az, t, az);
+            rw = madd(bw - aw, t, aw);
+            const float4 invLen = float4(1.f) / SIMD::sqrt(madd(rx, rx, madd(ry, ry, madd(rz, rz, rw * rw))));
+            rx *= invLen; ry *= invLen; rz *= invLen; rw *= invLen;
+        }
+
+        /**
+         * @brief out = lerp(a, b, weight * mask[j]) per joint; rotations use nlerp.
+         *        out may alias a or b.
+         * @param jointWeights Optional per-joint weights (layer mask), paddedCount() long.
+         */
+        inline void
+            blend(const Pose& a, const Pose& b, float weight, Pose& out, const float* jointWeights = nullptr) {
+            using SIMD::float4;
+            const float4 w(weight);
+            const int n = out.paddedCount();
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                const float4 t = jointWeights ? w * float4::loadu(jointWeights + i) : w;
+                for (int s = Pose::TX; s <= Pose::TZ; ++s) {
+                    const Pose::Stream st = static_cast<Pose::Stream>(s);
+                    const float4 va = float4::loadu(a.stream(st) + i);
+                    madd(float4::loadu(b.stream(st) + i) - va, t, va).storeu(out.stream(st) + i);
+                }
+                for (int s = Pose::SX; s <= Pose::SZ; ++s) {
+                    const Pose::Stream st = static_cast<Pose::Stream>(s);
+                    const float4 va = float4::loadu(a.stream(st) + i);
+                    madd(float4::loadu(b.stream(st) + i) - va, t, va).storeu(out.stream(st) + i);
+                }
+                float4 rx, ry, rz, rw;
+                nlerp(float4::loadu(a.stream(Pose::RX) + i), float4::loadu(a.stream(Pose::RY) + i),
+                      float4::loadu(a.stream(Pose::RZ) + i), float4::loadu(a.stream(Pose::RW) + i),
+                      float4::loadu(b.stream(Pose::RX) + i), float4::loadu(b.stream(Pose::RY) + i),
+                      float4::loadu(b.stream(Pose::RZ) + i), float4::loadu(b.stream(Pose::RW) + i),
+                      t, rx, ry, rz, rw);
+                rx.storeu(out.stream(Pose::RX) + i); ry.storeu(out.stream(Pose::RY) + i);
+                rz.storeu(out.stream(Pose::RZ) + i); rw.storeu(out.stream(Pose::RW) + i);
+            }
+        }
+
+        /**
+         * @brief Builds an additive delta: source relative to reference.
+         *        Translation source - reference, rotation reference^-1 * source,
+         *        scale source / reference.
+         */
+        inline void
+            makeAdditive(const Pose& source, const Pose& reference, Pose& delta) {
+            using SIMD::float4;
+            const int n = delta.paddedCount();
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                for (int c = 0; c < 3; ++c) {
+                    const Pose::Stream t = static_cast<Pose::Stream>(Pose::TX + c);
+                    const Pose::Stream s = static_cast<Pose::Stream>(Pose::SX + c);
+                    (float4::loadu(source.stream(t) + i) - float4::loadu(reference.stream(t) + i)).storeu(delta.stream(t) + i);
+                    (float4::loadu(source.stream(s) + i) / float4::loadu(reference.stream(s) + i)).storeu(delta.stream(s) + i);
+                }
+                // Conjugate of the (unit) reference times the source.
+                const float4 ax = -float4::loadu(reference.stream(Pose::RX) + i);
+                const float4 ay = -float4::loadu(reference.stream(Pose::RY) + i);
+                const float4 az = -float4::loadu(reference.stream(Pose::RZ) + i);
+                const float4 aw = float4::loadu(reference.stream(Pose::RW) + i);
+                const float4 bx = float4::loadu(source.stream(Pose::RX) + i);
+                const float4 by = float4::loadu(source.stream(Pose::RY) + i);
+                const float4 bz = float4::loadu(source.stream(Pose::RZ) + i);
+                const float4 bw = float4::loadu(source.stream(Pose::RW) + i);
+                (aw * bx + ax * bw + ay * bz - az * by).storeu(delta.stream(Pose::RX) + i);
+                (aw * by - ax * bz + ay * bw + az * bx).storeu(delta.stream(Pose::RY) + i);
+                (aw * bz + ax * by - ay * bx + az * bw).storeu(delta.stream(Pose::RZ) + i);
+                (aw * bw - ax * bx - ay * by - az * bz).storeu(delta.stream(Pose::RW) + i);
+            }
+        }
+
+        /**
+         * @brief Applies an additive delta on top of base with the given weight (and
+         *        optional per-joint mask): translation += w dT, rotation = base * nlerp(1, dR, w),
+         *        scale *= lerp(1, dS, w).
+         */
+        inline void
+            applyAdditive(Pose& base, const Pose& delta, float weight, const float* jointWeights = nullptr) {
+            using SIMD::float4;
+            const float4 w(weight), one(1.f), zero = float4::zero();
+            const int n = base.paddedCount();
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                const float4 t = jointWeights ? w * float4::loadu(jointWeights + i) : w;
+                for (int c = 0; c < 3; ++c) {
+                    const Pose::Stream ts = static_cast<Pose::Stream>(Pose::TX + c);
+                    const Pose::Stream ss = static_cast<Pose::Stream>(Pose::SX + c);
+                    madd(float4::loadu(delta.stream(ts) + i), t, float4::loadu(base.stream(ts) + i)).storeu(base.stream(ts) + i);
+                    const float4 s = madd(float4::loadu(delta.stream(ss) + i) - one, t, one);
+                    (float4::loadu(base.stream(ss) + i) * s).storeu(base.stream(ss) + i);
+                }
+                float4 dx, dy, dz, dw;
+                nlerp(zero, zero, zero, one,
+                      float4::loadu(delta.stream(Pose::RX) + i), float4::loadu(delta.stream(Pose::RY) + i),
+                      float4::loadu(delta.stream(Pose::RZ) + i), float4::loadu(delta.stream(Pose::RW) + i),
+                      t, dx, dy, dz, dw);
+                const float4 ax = float4::loadu(base.stream(Pose::RX) + i);
+                const float4 ay = float4::loadu(base.stream(Pose::RY) + i);
+                const float4 az = float4::loadu(base.stream(Pose::RZ) + i);
+                const float4 aw = float4::loadu(base.stream(Pose::RW) + i);
+                (aw * dx + ax * dw + ay * dz - az * dy).storeu(base.stream(Pose::RX) + i);
+                (aw * dy - ax * dz + ay * dw + az * dx).storeu(base.stream(Pose::RY) + i);
+                (aw * dz + ax * dy - ay * dx + az * dw).storeu(base.stream(Pose::RZ) + i);
+                (aw * dw - ax * dx - ay * dy - az * dz).storeu(base.stream(Pose::RW) + i);
+            }
+        }
+
+    } // namespace PoseBlend
+
+} // namespace EU
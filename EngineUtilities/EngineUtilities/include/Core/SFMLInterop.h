@@ -0,0 +1,271 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <SFML/System/Vector2.hpp>
+#include <SFML/System/Vector3.hpp>
+#include <SFML/Graphics/Transform.hpp>
+#include <SFML/Graphics/Glsl.hpp>
+#include <Vectors/Vector2.h>
+#include <Vectors/Vector3.h>
+#include <Vectors/Vector4.h>
+#include <Matrices/Affine2D.h>
+#include <Matrices/Matrix3x3.h>
+#include <Matrices/Matrix4x4.h>
+
+/**
+ * @file SFMLInterop.h
+ * @brief Conversions between EngineUtilities types and SFML types.
+ *
+ * CVector2, CVector3 and CVector4 have the same layout as sf::Vector2f,
+ * sf::Vector3f and sf::Glsl::Vec4 (checked below), so single values and whole
+ * arrays are reinterpreted in place instead of copied. Matrices cannot be shared
+ * that way: sf::Transform keeps a private 4x4 column-major matrix and GLSL expects
+ * column-major data, while Matrix3x3/Matrix4x4 are row-major. For those there are
+ * one-shot conversions and a bulk transpose whose output is an array of
+ * sf::Glsl::Mat4.
+ *
+ * MSVC does not use type-based alias analysis. With GCC/Clang, do not write an
+ * array through one type and read it through the other in the same function.
+ */
+
+namespace EU {
+    namespace SFMLInterop {
+
+        namespace detail {
+
+            /**
+             * @brief True if Engine and Sfml are standard-layout float aggregates with the
+             *        same size and alignment.
+             */
+            template<class Engine, class Sfml, std::size_t COMPONENTS>
+            struct
+                SameLayout {
+                static constexpr bool value =
+                    std::is_standard_layout<Engine>::value && std::is_standard_layout<Sfml>::value &&
+                    sizeof(Engine) == COMPONENTS * sizeof(float) && sizeof(Sfml) == COMPONENTS * sizeof(float) &&
+                    alignof(Engine) == alignof(Sfml);
+            };
+
+        } // namespace detail
+
+        static_assert(detail::SameLayout<CVector2, sf::Vector2f, 2>::value, "CVector2 must match sf::Vector2f");
+        static_assert(offsetof(CVector2, x) == offsetof(sf::Vector2f, x) &&
+                      offsetof(CVector2, y) == offsetof(sf::Vector2f, y), "CVector2 must match sf::Vector2f");
+
+        static_assert(detail::SameLayout<CVector3, sf::Vector3f, 3>::value, "CVector3 must match sf::Vector3f");
+        static_assert(offsetof(CVector3, x) == offsetof(sf::Vector3f, x) &&
+                      offsetof(CVector3, y) == offsetof(sf::Vector3f, y) &&
+                      offsetof(CVector3, z) == offsetof(sf::Vector3f, z), "CVector3 must match sf::Vector3f");
+
+        static_assert(detail::SameLayout<CVector4, sf::Glsl::Vec4, 4>::value, "CVector4 must match sf::Glsl::Vec4");
+        static_assert(offsetof(CVector4, x) == offsetof(sf::Glsl::Vec4, x) &&
+                      offsetof(CVector4, y) == offsetof(sf::Glsl::Vec4, y) &&
+                      offsetof(CVector4, z) == offsetof(sf::Glsl::Vec4, z) &&
+                      offsetof(CVector4, w) == offsetof(sf::Glsl::Vec4, w), "CVector4 must match sf::Glsl::Vec4");
+
+        static_assert(sizeof(sf::Glsl::Mat4) == 16 * sizeof(float), "sf::Glsl::Mat4 must be 16 packed floats");
+        static_assert(sizeof(sf::Glsl::Mat3) == 9 * sizeof(float), "sf::Glsl::Mat3 must be 9 packed floats");
+
+        // Views (no copy)
+
+        inline sf::Vector2f&
+            asSFML(CVector2& v) {
+            return reinterpret_cast<sf::Vector2f&>(v);
+        }
+
+        inline const sf::Vector2f&
+            asSFML(const CVector2& v) {
+            return reinterpret_cast<const sf::Vector2f&>(v);
+        }
+
+        inline sf::Vector3f&
+            asSFML(CVector3& v) {
+            return reinterpret_cast<sf::Vector3f&>(v);
+        }
+
+        inline const sf::Vector3f&
+            asSFML(const CVector3& v) {
+            return reinterpret_cast<const sf::Vector3f&>(v);
+        }
+
+        inline sf::Glsl::Vec4&
+            asSFML(CVector4& v) {
+            return reinterpret_cast<sf::Glsl::Vec4&>(v);
+        }
+
+        inline const sf::Glsl::Vec4&
+            asSFML(const CVector4& v) {
+            return reinterpret_cast<const sf::Glsl::Vec4&>(v);
+        }
+
+        inline CVector2&
+            asEngine(sf::Vector2f& v) {
+            return reinterpret_cast<CVector2&>(v);
+        }
+
+        inline const CVector2&
+            asEngine(const sf::Vector2f& v) {
+            return reinterpret_cast<const CVector2&>(v);
+        }
+
+        inline CVector3&
+            asEngine(sf::Vector3f& v) {
+            return reinterpret_cast<CVector3&>(v);
+        }
+
+        inline const CVector3&
+            asEngine(const sf::Vector3f& v) {
+            return reinterpret_cast<const CVector3&>(v);
+        }
+
+        inline CVector4&
+            asEngine(sf::Glsl::Vec4& v) {
+            return reinterpret_cast<CVector4&>(v);
+        }
+
+        inline const CVector4&
+            asEngine(const sf::Glsl::Vec4& v) {
+            return reinterpret_cast<const CVector4&>(v);
+        }
+
+        /**
+         * @brief Reinterprets an array of count CVector2 as sf::Vector2f (e.g. for
+         *        sf::Shader::setUniformArray). The same pointer overloads exist for
+         *        CVector3/sf::Vector3f and CVector4/sf::Glsl::Vec4.
+         */
+        inline sf::Vector2f*
+            asSFML(CVector2* data) {
+            return reinterpret_cast<sf::Vector2f*>(data);
+        }
+
+        inline const sf::Vector2f*
+            asSFML(const CVector2* data) {
+            return reinterpret_cast<const sf::Vector2f*>(data);
+        }
+
+        inline sf::Vector3f*
+            asSFML(CVector3* data) {
+            return reinterpret_cast<sf::Vector3f*>(data);
+        }
+
+        inline const sf::Vector3f*
+            asSFML(const CVector3* data) {
+            return reinterpret_cast<const sf::Vector3f*>(data);
+        }
+
+        inline sf::Glsl::Vec4*
+            asSFML(CVector4* data) {
+            return reinterpret_cast<sf::Glsl::Vec4*>(data);
+        }
+
+        inline const sf::Glsl::Vec4*
+            asSFML(const CVector4* data) {
+            return reinterpret_cast<const sf::Glsl::Vec4*>(data);
+        }
+
+        inline CVector2*
+            asEngine(sf::Vector2f* data) {
+            return reinterpret_cast<CVector2*>(data);
+        }
+
+        inline const CVector2*
+            asEngine(const sf::Vector2f* data) {
+            return reinterpret_cast<const CVector2*>(data);
+        }
+
+        inline CVector3*
+            asEngine(sf::Vector3f* data) {
+            return reinterpret_cast<CVector3*>(data);
+        }
+
+        inline const CVector3*
+            asEngine(const sf::Vector3f* data) {
+            return reinterpret_cast<const CVector3*>(data);
+        }
+
+        inline CVector4*
+            asEngine(sf::Glsl::Vec4* data) {
+            return reinterpret_cast<CVector4*>(data);
+        }
+
+        inline const CVector4*
+            asEngine(const sf::Glsl::Vec4* data) {
+            return reinterpret_cast<const CVector4*>(data);
+        }
+
+        // Matrices (copy)
+
+        /**
+         * @brief sf::Transform uses the same convention as Matrix3x3 (column vectors,
+         *        translation in the last column), so the elements map one to one.
+         */
+        inline sf::Transform
+            toTransform(const Matrix3x3& m) {
+            return sf::Transform(m.m[0][0], m.m[0][1], m.m[0][2],
+                                 m.m[1][0], m.m[1][1], m.m[1][2],
+                                 m.m[2][0], m.m[2][1], m.m[2][2]);
+        }
+
+        inline sf::Transform
+            toTransform(const Affine2D& a) {
+            return sf::Transform(a.m00, a.m01, a.tx,
+                                 a.m10, a.m11, a.ty,
+                                 0.f, 0.f, 1.f);
+        }
+
+        /**
+         * @brief Affine part of sf::Transform's column-major 4x4 matrix.
+         */
+        inline Affine2D
+            toAffine2D(const sf::Transform& t) {
+            const float* a = t.getMatrix();
+            return Affine2D(a[0], a[4], a[1], a[5], a[12], a[13]);
+        }
+
+        /**
+         * @brief Reads the 3x3 part back out of sf::Transform's column-major 4x4 matrix.
+         */
+        inline Matrix3x3
+            toMatrix3x3(const sf::Transform& t) {
+            const float* a = t.getMatrix();
+            return Matrix3x3(a[0], a[4], a[12],
+                             a[1], a[5], a[13],
+                             a[3], a[7], a[15]);
+        }
+
+        /**
+         * @brief Writes count row-major matrices as column-major floats (16 per matrix).
+         */
+        inline void
+            toColumnMajor(const Matrix4x4* in, float* out, int count) {
+            for (int i = 0; i < count; ++i) {
+                const float* src = &in[i].m[0][0];
+                float* dst = out + 16 * i;
+                for (int col = 0; col < 4; ++col) {
+                    dst[col * 4 + 0] = src[0 * 4 + col];
+                    dst[col * 4 + 1] = src[1 * 4 + col];
+                    dst[col * 4 + 2] = src[2 * 4 + col];
+                    dst[col * 4 + 3] = src[3 * 4 + col];
+                }
+            }
+        }
+
+        inline sf::Glsl::Mat4
+            toGlsl(const Matrix4x4& m) {
+            float columnMajor[16];
+            toColumnMajor(&m, columnMajor, 1);
+            return sf::Glsl::Mat4(columnMajor);
+        }
+
+        /**
+         * @brief Views the output of toColumnMajor as count sf::Glsl::Mat4, ready for
+         *        sf::Shader::setUniformArray.
+         */
+        inline const sf::Glsl::Mat4*
+            asGlslMat4(const float* columnMajor) {
+            return reinterpret_cast<const sf::Glsl::Mat4*>(columnMajor);
+        }
+
+    } // namespace SFMLInterop
+} // namespace EU
@@ -0,0 +1,516 @@
+#pragma once
+
+/**
+ * @file SIMD.h
+ * @brief Thin 4-lane float and int (and 2-lane double) wrappers used by the batched
+ *        math kernels.
+ *
+ * Maps to SSE2 when the target supports it (always true on x64) and falls back to
+ * plain scalar code otherwise, so every kernel built on it compiles everywhere.
+ * Define EU_SIMD_SCALAR to force the scalar path.
+ */
+
+#include <Math/EngineMath.h>
+
+#if !defined(EU_SIMD_SCALAR) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define EU_SIMD_SSE 1
+#include <emmintrin.h>
+#else
+#define EU_SIMD_SSE 0
+#include <cmath>
+#endif
+
+#if EU_SIMD_SSE && (defined(__SSE4_1__) || defined(__AVX__))
+#define EU_SIMD_SSE41 1
+#include <smmintrin.h>
+#else
+#define EU_SIMD_SSE41 0
+#endif
+
+#if EU_SIMD_SSE && (defined(__FMA__) || defined(__AVX2__))
+#define EU_SIMD_FMA 1
+#include <immintrin.h>
+#else
+#define EU_SIMD_FMA 0
+#endif
+
+#if EU_SIMD_SSE && (defined(__F16C__) || defined(__AVX2__))
+#define EU_SIMD_F16C 1
+#include <immintrin.h>
+#else
+#define EU_SIMD_F16C 0
+#endif
+
+namespace EU {
+    namespace SIMD {
+
+        /**
+         * @brief Number of float lanes processed per SIMD register.
+         */
+        constexpr int LANES = 4;
+
+        /**
+         * @class float4
+         * @brief Four packed floats. Comparisons return lane masks (all bits set or clear).
+         */
+        struct alignas(16)
+            float4 {
+#if EU_SIMD_SSE
+            __m128 v;
+
+            float4() : v(_mm_setzero_ps()) {}
+            float4(__m128 value) : v(value) {}
+
+            /**
+             * @brief Broadcasts a scalar to all lanes.
+             */
+            explicit float4(float s) : v(_mm_set1_ps(s)) {}
+
+            /**
+             * @brief Builds a register from four scalars (lane 0 first).
+             */
+            float4(float a, float b, float c, float d) : v(_mm_setr_ps(a, b, c, d)) {}
+
+            /**
+             * @brief Loads four floats from a 16-byte aligned address.
+             */
+            static
+                float4 load(const float* p) { return float4(_mm_load_ps(p)); }
+
+            /**
+             * @brief Loads four floats from an unaligned address.
+             */
+            static
+                float4 loadu(const float* p) { return float4(_mm_loadu_ps(p)); }
+
+            void
+                store(float* p) const { _mm_store_ps(p, v); }
+
+            void
+                storeu(float* p) const { _mm_storeu_ps(p, v); }
+
+            /**
+             * @brief Reads a single lane. Slow path, meant for tails and debugging.
+             */
+            float
+                lane(int i) const {
+                alignas(16) float tmp[4];
+                _mm_store_ps(tmp, v);
+                return tmp[i];
+            }
+#else
+            float v[4];
+
+            float4() : v{ 0.f, 0.f, 0.f, 0.f } {}
+            explicit float4(float s) : v{ s, s, s, s } {}
+            float4(float a, float b, float c, float d) : v{ a, b, c, d } {}
+
+            static
+                float4 load(const float* p) { return float4(p[0], p[1], p[2], p[3]); }
+
+            static
+                float4 loadu(const float* p) { return float4(p[0], p[1], p[2], p[3]); }
+
+            void
+                store(float* p) const { for (int i = 0; i < 4; ++i) p[i] = v[i]; }
+
+            void
+                storeu(float* p) const { for (int i = 0; i < 4; ++i) p[i] = v[i]; }
+
+            float
+                lane(int i) const { return v[i]; }
+#endif
+
+            static
+                float4 zero() { return float4(); }
+        };
+
+#if EU_SIMD_SSE
+        inline float4 operator+(const float4& a, const float4& b) { return _mm_add_ps(a.v, b.v); }
+        inline float4 operator-(const float4& a, const float4& b) { return _mm_sub_ps(a.v, b.v); }
+        inline float4 operator*(const float4& a, const float4& b) { return _mm_mul_ps(a.v, b.v); }
+        inline float4 operator/(const float4& a, const float4& b) { return _mm_div_ps(a.v, b.v); }
+        inline float4 operator-(const float4& a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.f)); }
+
+        inline float4 operator&(const float4& a, const float4& b) { return _mm_and_ps(a.v, b.v); }
+        inline float4 operator|(const float4& a, const float4& b) { return _mm_or_ps(a.v, b.v); }
+        inline float4 operator^(const float4& a, const float4& b) { return _mm_xor_ps(a.v, b.v); }
+
+        /**
+         * @brief Returns a & ~mask, i.e. clears the lanes selected by mask.
+         */
+        inline float4 andNot(const float4& mask, const float4& a) { return _mm_andnot_ps(mask.v, a.v); }
+
+        inline float4 operator<(const float4& a, const float4& b) { return _mm_cmplt_ps(a.v, b.v); }
+        inline float4 operator<=(const float4& a, const float4& b) { return _mm_cmple_ps(a.v, b.v); }
+        inline float4 operator>(const float4& a, const float4& b) { return _mm_cmpgt_ps(a.v, b.v); }
+        inline float4 operator>=(const float4& a, const float4& b) { return _mm_cmpge_ps(a.v, b.v); }
+        inline float4 operator==(const float4& a, const float4& b) { return _mm_cmpeq_ps(a.v, b.v); }
+        inline float4 operator!=(const float4& a, const float4& b) { return _mm_cmpneq_ps(a.v, b.v); }
+
+        inline float4 min(const float4& a, const float4& b) { return _mm_min_ps(a.v, b.v); }
+        inline float4 max(const float4& a, const float4& b) { return _mm_max_ps(a.v, b.v); }
+        inline float4 sqrt(const float4& a) { return _mm_sqrt_ps(a.v); }
+        inline float4 abs(const float4& a) { return _mm_andnot_ps(_mm_set1_ps(-0.f), a.v); }
+
+        /**
+         * @brief Per-lane select: mask ? a : b.
+         */
+        inline float4 select(const float4& mask, const float4& a, const float4& b) {
+            return _mm_or_ps(_mm_and_ps(mask.v, a.v), _mm_andnot_ps(mask.v, b.v));
+        }
+
+        /**
+         * @brief Packs the sign bit of every lane into the low 4 bits of an int.
+         */
+        inline int movemask(const float4& a) { return _mm_movemask_ps(a.v); }
+
+        /**
+         * @brief Expands the low 4 bits of an int into a lane mask (inverse of movemask).
+         */
+        inline float4 maskFromBits(int bits) {
+            const __m128i lanes = _mm_setr_epi32(1, 2, 4, 8);
+            const __m128i b = _mm_and_si128(_mm_set1_epi32(bits), lanes);
+            return _mm_castsi128_ps(_mm_cmpeq_epi32(b, lanes));
+        }
+
+        /**
+         * @brief Fused multiply-add a * b + c (single rounding when FMA is available).
+         */
+        inline float4 madd(const float4& a, const float4& b, const float4& c) {
+#if EU_SIMD_FMA
+            return _mm_fmadd_ps(a.v, b.v, c.v);
+#else
+            return _mm_add_ps(_mm_mul_ps(a.v, b.v), c.v);
+#endif
+        }
+
+        /**
+         * @brief Rounds every lane toward negative infinity.
+         */
+        inline float4 floor(const float4& a) {
+            __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+            return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a.v), _mm_set1_ps(1.f)));
+        }
+#else
+        namespace detail {
+            union LaneBits { float f; unsigned int u; };
+
+            inline float bits(unsigned int u) { LaneBits b; b.u = u; return b.f; }
+            inline unsigned int bits(float f) { LaneBits b; b.f = f; return b.u; }
+            inline float mask(bool c) { return bits(c ? 0xFFFFFFFFu : 0u); }
+        }
+
+#define EU_SIMD_LANEWISE(expr) float4 r; for (int i = 0; i < 4; ++i) r.v[i] = (expr); return r
+
+        inline float4 operator+(const float4& a, const float4& b) { EU_SIMD_LANEWISE(a.v[i] + b.v[i]); }
+        inline float4 operator-(const float4& a, const float4& b) { EU_SIMD_LANEWISE(a.v[i] - b.v[i]); }
+        inline float4 operator*(const float4& a, const float4& b) { EU_SIMD_LANEWISE(a.v[i] * b.v[i]); }
+        inline float4 operator/(const float4& a, const float4& b) { EU_SIMD_LANEWISE(a.v[i] / b.v[i]); }
+        inline float4 operator-(const float4& a) { EU_SIMD_LANEWISE(-a.v[i]); }
+
+        inline float4 operator&(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::bits(detail::bits(a.v[i]) & detail::bits(b.v[i]))); }
+        inline float4 operator|(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::bits(detail::bits(a.v[i]) | detail::bits(b.v[i]))); }
+        inline float4 operator^(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::bits(detail::bits(a.v[i]) ^ detail::bits(b.v[i]))); }
+        inline float4 andNot(const float4& mask, const float4& a) { EU_SIMD_LANEWISE(detail::bits(~detail::bits(mask.v[i]) & detail::bits(a.v[i]))); }
+
+        inline float4 operator<(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::mask(a.v[i] < b.v[i])); }
+        inline float4 operator<=(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::mask(a.v[i] <= b.v[i])); }
+        inline float4 operator>(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::mask(a.v[i] > b.v[i])); }
+        inline float4 operator>=(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::mask(a.v[i] >= b.v[i])); }
+        inline float4 operator==(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::mask(a.v[i] == b.v[i])); }
+        inline float4 operator!=(const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::mask(a.v[i] != b.v[i])); }
+
+        inline float4 min(const float4& a, const float4& b) { EU_SIMD_LANEWISE(a.v[i] < b.v[i] ? a.v[i] : b.v[i]); }
+        inline float4 max(const float4& a, const float4& b) { EU_SIMD_LANEWISE(a.v[i] > b.v[i] ? a.v[i] : b.v[i]); }
+        inline float4 sqrt(const float4& a) { EU_SIMD_LANEWISE(Math::sqrt(a.v[i])); }
+        inline float4 abs(const float4& a) { EU_SIMD_LANEWISE(a.v[i] < 0.f ? -a.v[i] : a.v[i]); }
+        inline float4 select(const float4& mask, const float4& a, const float4& b) { EU_SIMD_LANEWISE(detail::bits(mask.v[i]) ? a.v[i] : b.v[i]); }
+        inline float4 madd(const float4& a, const float4& b, const float4& c) { EU_SIMD_LANEWISE(a.v[i] * b.v[i] + c.v[i]); }
+        inline float4 floor(const float4& a) { EU_SIMD_LANEWISE(static_cast<float>(Math::floor(a.v[i]))); }
+
+        inline int movemask(const float4& a) {
+            int m = 0;
+            for (int i = 0; i < 4; ++i) m |= static_cast<int>(detail::bits(a.v[i]) >> 31) << i;
+            return m;
+        }
+
+        inline float4 maskFromBits(int bits) { EU_SIMD_LANEWISE(detail::mask(((bits >> i) & 1) != 0)); }
+
+#undef EU_SIMD_LANEWISE
+#endif
+
+        inline float4& operator+=(float4& a, const float4& b) { a = a + b; return a; }
+        inline float4& operator-=(float4& a, const float4& b) { a = a - b; return a; }
+        inline float4& operator*=(float4& a, const float4& b) { a = a * b; return a; }
+        inline float4& operator/=(float4& a, const float4& b) { a = a / b; return a; }
+
+        /**
+         * @brief True if any lane of the mask is set.
+         */
+        inline bool anyTrue(const float4& mask) { return movemask(mask) != 0; }
+
+        /**
+         * @brief True if every lane of the mask is set.
+         */
+        inline bool allTrue(const float4& mask) { return movemask(mask) == 0xF; }
+
+        /**
+         * @brief Lane-wise dot product of two vectors stored as SoA registers.
+         */
+        inline float4 dot3(const float4& ax, const float4& ay, const float4& az,
+                           const float4& bx, const float4& by, const float4& bz) {
+            return madd(ax, bx, madd(ay, by, az * bz));
+        }
+
+        /**
+         * @brief Lane-wise cross product of two vectors stored as SoA registers.
+         */
+        inline void cross3(const float4& ax, const float4& ay, const float4& az,
+                           const float4& bx, const float4& by, const float4& bz,
+                           float4& rx, float4& ry, float4& rz) {
+            rx = ay * bz - az * by;
+            ry = az * bx - ax * bz;
+            rz = ax * by - ay * bx;
+        }
+
+        /**
+         * @class int4
+         * @brief Four packed 32-bit integers, for hashing and lattice indices next to
+         *        float4. Arithmetic wraps around like unsigned integers.
+         */
+        struct alignas(16)
+            int4 {
+#if EU_SIMD_SSE
+            __m128i v;
+
+            int4() : v(_mm_setzero_si128()) {}
+            int4(__m128i value) : v(value) {}
+
+            /**
+             * @brief Broadcasts a scalar to all lanes.
+             */
+            explicit int4(int s) : v(_mm_set1_epi32(s)) {}
+
+            int4(int a, int b, int c, int d) : v(_mm_setr_epi32(a, b, c, d)) {}
+
+            static
+                int4 loadu(const int* p) { return int4(_mm_loadu_si128(reinterpret_cast<const __m128i*>(p))); }
+
+            void
+                storeu(int* p) const { _mm_storeu_si128(reinterpret_cast<__m128i*>(p), v); }
+
+            int
+                lane(int i) const {
+                alignas(16) int tmp[4];
+                _mm_store_si128(reinterpret_cast<__m128i*>(tmp), v);
+                return tmp[i];
+            }
+#else
+            int v[4];
+
+            int4() : v{ 0, 0, 0, 0 } {}
+            explicit int4(int s) : v{ s, s, s, s } {}
+            int4(int a, int b, int c, int d) : v{ a, b, c, d } {}
+
+            static
+                int4 loadu(const int* p) { return int4(p[0], p[1], p[2], p[3]); }
+
+            void
+                storeu(int* p) const { for (int i = 0; i < 4; ++i) p[i] = v[i]; }
+
+            int
+                lane(int i) const { return v[i]; }
+#endif
+        };
+
+#if EU_SIMD_SSE
+        inline int4 operator+(const int4& a, const int4& b) { return _mm_add_epi32(a.v, b.v); }
+        inline int4 operator-(const int4& a, const int4& b) { return _mm_sub_epi32(a.v, b.v); }
+
+        /**
+         * @brief Low 32 bits of the lane-wise product. SSE2 has no 32-bit multiply, so it
+         *        is assembled from two 32x32->64 multiplies of the even and odd lanes.
+         */
+        inline int4 operator*(const int4& a, const int4& b) {
+#if EU_SIMD_SSE41
+            return _mm_mullo_epi32(a.v, b.v);
+#else
+            const __m128i even = _mm_mul_epu32(a.v, b.v);
+            const __m128i odd = _mm_mul_epu32(_mm_srli_si128(a.v, 4), _mm_srli_si128(b.v, 4));
+            return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                                      _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+#endif
+        }
+
+        inline int4 operator&(const int4& a, const int4& b) { return _mm_and_si128(a.v, b.v); }
+        inline int4 operator|(const int4& a, const int4& b) { return _mm_or_si128(a.v, b.v); }
+        inline int4 operator^(const int4& a, const int4& b) { return _mm_xor_si128(a.v, b.v); }
+
+        inline int4 operator==(const int4& a, const int4& b) { return _mm_cmpeq_epi32(a.v, b.v); }
+        inline int4 operator<(const int4& a, const int4& b) { return _mm_cmplt_epi32(a.v, b.v); }
+        inline int4 operator>(const int4& a, const int4& b) { return _mm_cmpgt_epi32(a.v, b.v); }
+
+        /**
+         * @brief Shifts every lane left by a compile-time count.
+         */
+        template<int N>
+        inline int4 shiftLeft(const int4& a) { return _mm_slli_epi32(a.v, N); }
+
+        /**
+         * @brief Shifts every lane right by a compile-time count, filling with zeros.
+         */
+        template<int N>
+        inline int4 shiftRight(const int4& a) { return _mm_srli_epi32(a.v, N); }
+
+        /**
+         * @brief Converts with truncation toward zero.
+         */
+        inline int4 toInt(const float4& a) { return _mm_cvttps_epi32(a.v); }
+        inline float4 toFloat(const int4& a) { return _mm_cvtepi32_ps(a.v); }
+
+        /**
+         * @brief Reinterprets the bits (no conversion), e.g. to use an int4 mask in select().
+         */
+        inline float4 asFloat(const int4& a) { return _mm_castsi128_ps(a.v); }
+        inline int4 asInt(const float4& a) { return _mm_castps_si128(a.v); }
+#else
+#define EU_SIMD_LANEWISE_INT(expr) int4 r; for (int i = 0; i < 4; ++i) r.v[i] = static_cast<int>(expr); return r
+
+        inline int4 operator+(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(static_cast<unsigned int>(a.v[i]) + static_cast<unsigned int>(b.v[i])); }
+        inline int4 operator-(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(static_cast<unsigned int>(a.v[i]) - static_cast<unsigned int>(b.v[i])); }
+        inline int4 operator*(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(static_cast<unsigned int>(a.v[i]) * static_cast<unsigned int>(b.v[i])); }
+
+        inline int4 operator&(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(a.v[i] & b.v[i]); }
+        inline int4 operator|(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(a.v[i] | b.v[i]); }
+        inline int4 operator^(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(a.v[i] ^ b.v[i]); }
+
+        inline int4 operator==(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(a.v[i] == b.v[i] ? -1 : 0); }
+        inline int4 operator<(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(a.v[i] < b.v[i] ? -1 : 0); }
+        inline int4 operator>(const int4& a, const int4& b) { EU_SIMD_LANEWISE_INT(a.v[i] > b.v[i] ? -1 : 0); }
+
+        template<int N>
+        inline int4 shiftLeft(const int4& a) { EU_SIMD_LANEWISE_INT(static_cast<unsigned int>(a.v[i]) << N); }
+
+        template<int N>
+        inline int4 shiftRight(const int4& a) { EU_SIMD_LANEWISE_INT(static_cast<unsigned int>(a.v[i]) >> N); }
+
+        inline int4 toInt(const float4& a) { EU_SIMD_LANEWISE_INT(a.v[i]); }
+
+        inline int4 asInt(const float4& a) { EU_SIMD_LANEWISE_INT(detail::bits(a.v[i])); }
+
+#undef EU_SIMD_LANEWISE_INT
+
+        inline float4 toFloat(const int4& a) { return float4(static_cast<float>(a.v[0]), static_cast<float>(a.v[1]),
+                                                             static_cast<float>(a.v[2]), static_cast<float>(a.v[3])); }
+
+        inline float4 asFloat(const int4& a) {
+            return float4(detail::bits(static_cast<unsigned int>(a.v[0])), detail::bits(static_cast<unsigned int>(a.v[1])),
+                          detail::bits(static_cast<unsigned int>(a.v[2])), detail::bits(static_cast<unsigned int>(a.v[3])));
+        }
+#endif
+
+        /**
+         * @class double2
+         * @brief Two packed doubles, for the double-precision math types.
+         */
+        struct alignas(16)
+            double2 {
+#if EU_SIMD_SSE
+            __m128d v;
+
+            double2() : v(_mm_setzero_pd()) {}
+            double2(__m128d value) : v(value) {}
+
+            /**
+             * @brief Broadcasts a scalar to both lanes.
+             */
+            explicit double2(double s) : v(_mm_set1_pd(s)) {}
+
+            double2(double a, double b) : v(_mm_setr_pd(a, b)) {}
+
+            static
+                double2 loadu(const double* p) { return double2(_mm_loadu_pd(p)); }
+
+            void
+                storeu(double* p) const { _mm_storeu_pd(p, v); }
+
+            double
+                lane(int i) const {
+                alignas(16) double tmp[2];
+                _mm_store_pd(tmp, v);
+                return tmp[i];
+            }
+#else
+            double v[2];
+
+            double2() : v{ 0.0, 0.0 } {}
+            explicit double2(double s) : v{ s, s } {}
+            double2(double a, double b) : v{ a, b } {}
+
+            static
+                double2 loadu(const double* p) { return double2(p[0], p[1]); }
+
+            void
+                storeu(double* p) const { p[0] = v[0]; p[1] = v[1]; }
+
+            double
+                lane(int i) const { return v[i]; }
+#endif
+        };
+
+#if EU_SIMD_SSE
+        inline double2 operator+(const double2& a, const double2& b) { return _mm_add_pd(a.v, b.v); }
+        inline double2 operator-(const double2& a, const double2& b) { return _mm_sub_pd(a.v, b.v); }
+        inline double2 operator*(const double2& a, const double2& b) { return _mm_mul_pd(a.v, b.v); }
+        inline double2 operator/(const double2& a, const double2& b) { return _mm_div_pd(a.v, b.v); }
+
+        /**
+         * @brief Rounds two double pairs to one float4 (lo in lanes 0-1, hi in lanes 2-3).
+         */
+        inline float4 toFloat(const double2& lo, const double2& hi) { return _mm_movelh_ps(_mm_cvtpd_ps(lo.v), _mm_cvtpd_ps(hi.v)); }
+
+        inline double2 min(const double2& a, const double2& b) { return _mm_min_pd(a.v, b.v); }
+        inline double2 max(const double2& a, const double2& b) { return _mm_max_pd(a.v, b.v); }
+        inline double2 sqrt(const double2& a) { return _mm_sqrt_pd(a.v); }
+#else
+        inline double2 operator+(const double2& a, const double2& b) { return double2(a.v[0] + b.v[0], a.v[1] + b.v[1]); }
+        inline double2 operator-(const double2& a, const double2& b) { return double2(a.v[0] - b.v[0], a.v[1] - b.v[1]); }
+        inline double2 operator*(const double2& a, const double2& b) { return double2(a.v[0] * b.v[0], a.v[1] * b.v[1]); }
+        inline double2 operator/(const double2& a, const double2& b) { return double2(a.v[0] / b.v[0], a.v[1] / b.v[1]); }
+
+        inline float4 toFloat(const double2& lo, const double2& hi) {
+            return float4(static_cast<float>(lo.v[0]), static_cast<float>(lo.v[1]), static_cast<float>(hi.v[0]), static_cast<float>(hi.v[1]));
+        }
+
+        inline double2 min(const double2& a, const double2& b) { return double2(a.v[0] < b.v[0] ? a.v[0] : b.v[0], a.v[1] < b.v[1] ? a.v[1] : b.v[1]); }
+        inline double2 max(const double2& a, const double2& b) { return double2(a.v[0] > b.v[0] ? a.v[0] : b.v[0], a.v[1] > b.v[1] ? a.v[1] : b.v[1]); }
+
+        // std::sqrt is correctly rounded like sqrtpd and covers the whole double range,
+        // which a float-seeded iteration does not.
+        inline double2 sqrt(const double2& a) { return double2(std::sqrt(a.v[0]), std::sqrt(a.v[1])); }
+#endif
+
+        /**
+         * @brief Lane-wise sine and cosine of x in radians (Cody-Waite reduction to
+         *        [-pi/4, pi/4], then minimax polynomials; error about 2 ulp for |x| < 8192).
+         */
+        inline void sinCos(const float4& x, float4& s, float4& c) {
+            const float4 q = floor(madd(x, float4(0.63661977f), float4(0.5f)));
+            float4 r = madd(q, float4(-1.5703125f), x);
+            r = madd(q, float4(-4.837512969970703125e-4f), r);
+            r = madd(q, float4(-7.54978995489188216e-8f), r);
+            const float4 r2 = r * r;
+            const float4 sinR = madd(r * r2, madd(r2, madd(r2, float4(-1.9515295891e-4f), float4(8.3321608736e-3f)),
+                                                  float4(-1.6666654611e-1f)), r);
+            const float4 cosR = madd(r2 * r2, madd(r2, madd(r2, float4(2.443315711809948e-5f), float4(-1.388731625493765e-3f)),
+                                                   float4(4.166664568298827e-2f)), madd(r2, float4(-0.5f), float4(1.f)));
+            // Quadrant: odd swaps sin and cos; bit 1 of q (resp. q + 1) flips the sign of sin (resp. cos).
+            const int4 qi = toInt(q);
+            const float4 swap = asFloat((qi & int4(1)) == int4(1));
+            s = select(swap, cosR, sinR) ^ asFloat(shiftLeft<30>(qi & int4(2)));
+            c = select(swap, sinR, cosR) ^ asFloat(shiftLeft<30>((qi + int4(1)) & int4(2)));
+        }
+
+    } // namespace SIMD
+} // namespace EU
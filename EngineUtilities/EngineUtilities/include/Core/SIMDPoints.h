@@ -0,0 +1,75 @@
+#pragma once
+
+#include <Core/SIMD.h>
+#include <Vectors/Vector3.h>
+#include <Matrices/Matrix4x4.h>
+
+/**
+ * @file SIMDPoints.h
+ * @brief Four CVector3 points per float4 register: loading and storing them as x, y
+ *        and z lanes, and transforming them by a Matrix4x4 without a divide.
+ *
+ * Kernels walking a point range handle its last partial group by passing fewer than
+ * LANES points.
+ */
+
+namespace EU {
+    namespace SIMD {
+
+        /**
+         * @brief Loads up to four points as x, y, z registers; missing lanes are 0.
+         */
+        inline void
+            gather(const CVector3* p, int lanes, float4& x, float4& y, float4& z) {
+            if (lanes >= LANES) {
+                x = float4(p[0].x, p[1].x, p[2].x, p[3].x);
+                y = float4(p[0].y, p[1].y, p[2].y, p[3].y);
+                z = float4(p[0].z, p[1].z, p[2].z, p[3].z);
+                return;
+            }
+            alignas(16) float s[3][4] = {};
+            for (int k = 0; k < lanes; ++k) {
+                s[0][k] = p[k].x;
+                s[1][k] = p[k].y;
+                s[2][k] = p[k].z;
+            }
+            x = float4::load(s[0]);
+            y = float4::load(s[1]);
+            z = float4::load(s[2]);
+        }
+
+        /**
+         * @brief Stores the first lanes points of x, y, z registers.
+         */
+        inline void
+            scatter(const float4& x, const float4& y, const float4& z, int lanes, CVector3* out) {
+            alignas(16) float s[3][4];
+            x.store(s[0]);
+            y.store(s[1]);
+            z.store(s[2]);
+            for (int k = 0; k < lanes; ++k) out[k] = CVector3(s[0][k], s[1][k], s[2][k]);
+        }
+
+        /**
+         * @brief Every element of m broadcast to a register, for transformPoints().
+         */
+        inline void
+            broadcast(const Matrix4x4& m, float4 (&rows)[4][4]) {
+            for (int r = 0; r < 4; ++r) {
+                for (int c = 0; c < 4; ++c) rows[r][c] = float4(m.m[r][c]);
+            }
+        }
+
+        /**
+         * @brief Homogeneous m * (p, 1) for four points; out holds x, y, z and w with
+         *        no divide.
+         */
+        inline void
+            transformPoints(const float4 (&rows)[4][4], const float4& x, const float4& y, const float4& z, float4 (&out)[4]) {
+            for (int r = 0; r < 4; ++r) {
+                out[r] = madd(x, rows[r][0], madd(y, rows[r][1], madd(z, rows[r][2], rows[r][3])));
+            }
+        }
+
+    } // namespace SIMD
+} // namespace EU
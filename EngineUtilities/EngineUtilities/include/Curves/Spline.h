@@ -0,0 +1,327 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <Vectors/Vector2.h>
+#include <Vectors/Vector3.h>
+
+/**
+ * @file Spline.h
+ * @brief Piecewise cubic splines (Catmull-Rom, Bezier, uniform B-spline) over
+ *        CVector2 or CVector3, with an arc-length table for constant-speed motion.
+ */
+
+namespace EU {
+
+    /**
+     * @brief Kind of cubic spline.
+     */
+    enum class
+        SplineType {
+        CatmullRom,     ///< Interpolates every control point (end points are repeated).
+        Bezier,         ///< Piecewise cubic Bezier: points 3k are on the curve, the rest are handles.
+        BSpline         ///< Uniform cubic B-spline: C2 smooth, approximates the control points.
+    };
+
+    /**
+     * @class Spline
+     * @brief Cubic spline over a vector type V (CVector2 or CVector3).
+     *
+     * The curve parameter u runs from 0 to segmentCount(); the integer part selects
+     * the segment and the fraction is the local parameter. For constant-speed
+     * traversal, build the arc-length table once with buildArcLengthTable() and
+     * sample by distance instead.
+     */
+    template<class V>
+    class
+        Spline {
+    public:
+        explicit Spline(SplineType type = SplineType::CatmullRom) : m_type(type) {}
+
+        Spline(SplineType type, const std::vector<V>& points) : m_type(type), m_points(points) {}
+
+        SplineType
+            type() const {
+            return m_type;
+        }
+
+        /**
+         * @brief Replaces the control points. Invalidates the arc-length table.
+         */
+        void
+            setPoints(const std::vector<V>& points) {
+            m_points = points;
+            m_lengths.clear();
+        }
+
+        const std::vector<V>&
+            points() const {
+            return m_points;
+        }
+
+        /**
+         * @brief Number of cubic segments defined by the control points.
+         */
+        int
+            segmentCount() const {
+            const int n = static_cast<int>(m_points.size());
+            switch (m_type) {
+            case SplineType::CatmullRom: return n >= 2 ? n - 1 : 0;
+            case SplineType::Bezier: return n >= 4 ? (n - 1) / 3 : 0;
+            case SplineType::BSpline: return n >= 4 ? n - 3 : 0;
+            }
+            return 0;
+        }
+
+        /**
+         * @brief Point on the curve.
+         * @param u Curve parameter in [0, segmentCount()], clamped.
+         */
+        V
+            evaluate(float u) const {
+            int segment;
+            float t;
+            if (!locate(u, segment, t)) return m_points.empty() ? V() : m_points[0];
+            float w[4];
+            weights(t, w);
+            return combine(segment, w);
+        }
+
+        /**
+         * @brief Derivative dP/du (tangent, not normalized).
+         */
+        V
+            derivative(float u) const {
+            int segment;
+            float t;
+            if (!locate(u, segment, t)) return V();
+            float w[4];
+            derivativeWeights(t, w);
+            return combine(segment, w);
+        }
+
+        /**
+         * @brief Evaluates many parameters in one call.
+         */
+        void
+            evaluate(const float* u, V* out, int count) const {
+            int segment;
+            float t, w[4];
+            for (int i = 0; i < count; ++i) {
+                if (!locate(u[i], segment, t)) {
+                    out[i] = m_points.empty() ? V() : m_points[0];
+                    continue;
+                }
+                weights(t, w);
+                out[i] = combine(segment, w);
+            }
+        }
+
+        // Arc length
+
+        /**
+         * @brief Precomputes cumulative arc length at samplesPerSegment uniform steps per
+         *        segment (5-point Gauss-Legendre on each step).
+         */
+        void
+            buildArcLengthTable(int samplesPerSegment = 16) {
+            const int segments = segmentCount();
+            m_samplesPerSegment = samplesPerSegment > 0 ? samplesPerSegment : 1;
+            const int steps = segments * m_samplesPerSegment;
+            m_lengths.assign(steps + 1, 0.f);
+            if (steps == 0) return;
+
+            static const float nodes[5] = { -0.9061798459f, -0.5384693101f, 0.f, 0.5384693101f, 0.9061798459f };
+            static const float gauss[5] = { 0.2369268851f, 0.4786286705f, 0.5688888889f, 0.4786286705f, 0.2369268851f };
+            const float h = 1.f / static_cast<float>(m_samplesPerSegment);
+            float total = 0.f;
+            for (int s = 0; s < steps; ++s) {
+                const float u0 = static_cast<float>(s) * h;
+                float length = 0.f;
+                for (int g = 0; g < 5; ++g) {
+                    length += gauss[g] * derivative(u0 + 0.5f * h * (nodes[g] + 1.f)).length();
+                }
+                total += 0.5f * h * length;
+                m_lengths[s + 1] = total;
+            }
+        }
+
+        /**
+         * @brief Total curve length (0 until buildArcLengthTable() was called).
+         */
+        float
+            length() const {
+            return m_lengths.empty() ? 0.f : m_lengths.back();
+        }
+
+        /**
+         * @brief Converts a distance along the curve into the curve parameter u.
+         * @param distance Distance from the start, clamped to [0, length()].
+         */
+        float
+            parameterAtDistance(float distance) const {
+            if (m_lengths.size() < 2) return 0.f;
+            const int step = static_cast<int>(std::upper_bound(m_lengths.begin(), m_lengths.end(), distance) - m_lengths.begin()) - 1;
+            return parameterInStep(step, distance);
+        }
+
+        /**
+         * @brief Point at a distance along the curve (constant-speed traversal).
+         */
+        V
+            evaluateAtDistance(float distance) const {
+            return evaluate(parameterAtDistance(distance));
+        }
+
+        /**
+         * @brief Evaluates many distances in one call. When the distances are sorted
+         *        ascending (e.g. evenly spaced samples, followers along a rail) the table
+         *        is walked once instead of binary searched per sample.
+         */
+        void
+            evaluateAtDistances(const float* distances, V* out, int count) const {
+            if (m_lengths.size() < 2) {
+                for (int i = 0; i < count; ++i) out[i] = m_points.empty() ? V() : m_points[0];
+                return;
+            }
+            const int lastStep = static_cast<int>(m_lengths.size()) - 2;
+            int step = 0;
+            float previous = -1.f;
+            for (int i = 0; i < count; ++i) {
+                const float d = distances[i];
+                if (d < previous) {
+                    // Out of order: fall back to a binary search for this sample.
+                    step = static_cast<int>(std::upper_bound(m_lengths.begin(), m_lengths.end(), d) - m_lengths.begin()) - 1;
+                    step = step < 0 ? 0 : step;
+                }
+                while (step < lastStep && m_lengths[step + 1] <= d) ++step;
+                previous = d;
+                out[i] = evaluate(parameterInStep(step, d));
+            }
+        }
+
+    private:
+        /**
+         * @brief Splits u into a segment index and a local parameter in [0, 1].
+         */
+        bool
+            locate(float u, int& segment, float& t) const {
+            const int segments = segmentCount();
+            if (segments == 0) return false;
+            if (u <= 0.f) {
+                segment = 0;
+                t = 0.f;
+                return true;
+            }
+            if (u >= static_cast<float>(segments)) {
+                segment = segments - 1;
+                t = 1.f;
+                return true;
+            }
+            segment = static_cast<int>(u);
+            t = u - static_cast<float>(segment);
+            return true;
+        }
+
+        float
+            parameterInStep(int step, float distance) const {
+            const int lastStep = static_cast<int>(m_lengths.size()) - 2;
+            if (step < 0) return 0.f;
+            if (step > lastStep) return static_cast<float>(segmentCount());
+            const float l0 = m_lengths[step], l1 = m_lengths[step + 1];
+            float f = l1 > l0 ? (distance - l0) / (l1 - l0) : 0.f;
+            f = f < 0.f ? 0.f : (f > 1.f ? 1.f : f);
+            return (static_cast<float>(step) + f) / static_cast<float>(m_samplesPerSegment);
+        }
+
+        /**
+         * @brief Basis weights of the four control points of a segment.
+         */
+        void
+            weights(float t, float w[4]) const {
+            const float t2 = t * t, t3 = t2 * t;
+            switch (m_type) {
+            case SplineType::CatmullRom:
+                w[0] = 0.5f * (-t3 + 2.f * t2 - t);
+                w[1] = 0.5f * (3.f * t3 - 5.f * t2 + 2.f);
+                w[2] = 0.5f * (-3.f * t3 + 4.f * t2 + t);
+                w[3] = 0.5f * (t3 - t2);
+                break;
+            case SplineType::Bezier: {
+                const float s = 1.f - t;
+                w[0] = s * s * s;
+                w[1] = 3.f * s * s * t;
+                w[2] = 3.f * s * t2;
+                w[3] = t3;
+                break;
+            }
+            case SplineType::BSpline:
+                w[0] = (1.f - 3.f * t + 3.f * t2 - t3) / 6.f;
+                w[1] = (4.f - 6.f * t2 + 3.f * t3) / 6.f;
+                w[2] = (1.f + 3.f * t + 3.f * t2 - 3.f * t3) / 6.f;
+                w[3] = t3 / 6.f;
+                break;
+            }
+        }
+
+        /**
+         * @brief Derivatives of the basis weights with respect to t.
+         */
+        void
+            derivativeWeights(float t, float w[4]) const {
+            const float t2 = t * t;
+            switch (m_type) {
+            case SplineType::CatmullRom:
+                w[0] = 0.5f * (-3.f * t2 + 4.f * t - 1.f);
+                w[1] = 0.5f * (9.f * t2 - 10.f * t);
+                w[2] = 0.5f * (-9.f * t2 + 8.f * t + 1.f);
+                w[3] = 0.5f * (3.f * t2 - 2.f * t);
+                break;
+            case SplineType::Bezier: {
+                const float s = 1.f - t;
+                w[0] = -3.f * s * s;
+                w[1] = 3.f * s * s - 6.f * s * t;
+                w[2] = 6.f * s * t - 3.f * t2;
+                w[3] = 3.f * t2;
+                break;
+            }
+            case SplineType::BSpline:
+                w[0] = (-3.f + 6.f * t - 3.f * t2) / 6.f;
+                w[1] = (-12.f * t + 9.f * t2) / 6.f;
+                w[2] = (3.f + 6.f * t - 9.f * t2) / 6.f;
+                w[3] = 3.f * t2 / 6.f;
+                break;
+            }
+        }
+
+        /**
+         * @brief Weighted sum of the four control points of a segment.
+         */
+        V
+            combine(int segment, const float w[4]) const {
+            const int n = static_cast<int>(m_points.size());
+            int first;
+            switch (m_type) {
+            case SplineType::Bezier: first = segment * 3; break;
+            case SplineType::BSpline: first = segment; break;
+            default: first = segment - 1; break;    // Catmull-Rom: P[i-1], P[i], P[i+1], P[i+2].
+            }
+            V result = V();
+            for (int k = 0; k < 4; ++k) {
+                int i = first + k;
+                i = i < 0 ? 0 : (i >= n ? n - 1 : i);
+                result += m_points[i] * w[k];
+            }
+            return result;
+        }
+
+        SplineType m_type;
+        std::vector<V> m_points;
+        std::vector<float> m_lengths;           ///< Cumulative arc length per table step.
+        int m_samplesPerSegment = 16;
+    };
+
+    typedef Spline<CVector2> Spline2;
+    typedef Spline<CVector3> Spline3;
+
+} // namespace EU
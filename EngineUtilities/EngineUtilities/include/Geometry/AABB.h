@@ -0,0 +1,117 @@
+#pragma once
+
+#include <Vectors/Vector3.h>
+#include <Core/Constants.h>
+#include <Math/EngineMath.h>
+
+/**
+ * @file AABB.h
+ * @brief Axis-aligned bounding box used by the spatial queries.
+ */
+
+namespace EU {
+
+    /**
+     * @class AABB
+     * @brief Axis-aligned box described by its minimum and maximum corners.
+     */
+    class
+        AABB {
+    public:
+        CVector3 min;
+        CVector3 max;
+
+        /**
+         * @brief Default constructor. Creates an empty (inverted) box that grows on the first expand.
+         */
+        AABB()
+            : min(Constants::INF, Constants::INF, Constants::INF),
+              max(Constants::NEG_INF, Constants::NEG_INF, Constants::NEG_INF) {
+        }
+
+        /**
+         * @brief Constructs a box from its corners.
+         * @param min Minimum corner.
+         * @param max Maximum corner.
+         */
+        AABB(const CVector3& min, const CVector3& max) : min(min), max(max) {}
+
+        /**
+         * @brief Grows the box to contain a point.
+         * @param p Point to include.
+         */
+        void
+            expand(const CVector3& p) {
+            min = CVector3(Math::EMin(min.x, p.x), Math::EMin(min.y, p.y), Math::EMin(min.z, p.z));
+            max = CVector3(Math::EMax(max.x, p.x), Math::EMax(max.y, p.y), Math::EMax(max.z, p.z));
+        }
+
+        /**
+         * @brief Grows the box to contain another box.
+         * @param other Box to include.
+         */
+        void
+            expand(const AABB& other) {
+            expand(other.min);
+            expand(other.max);
+        }
+
+        /**
+         * @brief Returns the center point of the box.
+         */
+        CVector3
+            center() const {
+            return (min + max) * 0.5f;
+        }
+
+        /**
+         * @brief Returns the size of the box along each axis.
+         */
+        CVector3
+            extent() const {
+            return max - min;
+        }
+
+        /**
+         * @brief Returns the index of the longest axis (0 = x, 1 = y, 2 = z).
+         */
+        int
+            longestAxis() const {
+            CVector3 e = extent();
+            if (e.x >= e.y && e.x >= e.z) return 0;
+            return e.y >= e.z ? 1 : 2;
+        }
+
+        /**
+         * @brief Returns the surface area of the box.
+         */
+        float
+            surfaceArea() const {
+            CVector3 e = extent();
+            return 2.f * (e.x * e.y + e.y * e.z + e.z * e.x);
+        }
+
+        /**
+         * @brief Checks whether a point lies inside the box (inclusive).
+         * @param p Point to test.
+         */
+        bool
+            contains(const CVector3& p) const {
+            return p.x >= min.x && p.x <= max.x &&
+                   p.y >= min.y && p.y <= max.y &&
+                   p.z >= min.z && p.z <= max.z;
+        }
+
+        /**
+         * @brief Checks whether two boxes overlap.
+         * @param other Box to test against.
+         */
+        bool
+            intersects(const AABB& other) const {
+            return min.x <= other.max.x && max.x >= other.min.x &&
+                   min.y <= other.max.y && max.y >= other.min.y &&
+                   min.z <= other.max.z && max.z >= other.min.z;
+        }
+    };
+
+} // namespace EU
@@ -0,0 +1,403 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <Geometry/AABB.h>
+#include <Geometry/Ray.h>
+#include <Geometry/RayPacket.h>
+#include <Core/SIMD.h>
+
+/**
+ * @file BVH.h
+ * @brief Bounding volume hierarchy over a triangle mesh with single-ray and
+ *        packet (4/8 rays) traversal.
+ */
+
+namespace EU {
+
+    /**
+     * @class TriangleBVH
+     * @brief Binary BVH built by median split on the longest centroid axis.
+     *
+     * Nodes live in one flat array and siblings are stored next to each other, so an
+     * interior node only keeps the index of its left child. Triangles are reordered and
+     * stored as (v0, e1, e2) so the intersection kernels do not recompute edges.
+     */
+    class
+        TriangleBVH {
+    public:
+        /**
+         * @brief Flat BVH node (32 bytes). count == 0 marks an interior node.
+         */
+        struct
+            Node {
+            float minX, minY, minZ;
+            int leftFirst;              ///< Left child index (interior) or first triangle (leaf).
+            float maxX, maxY, maxZ;
+            int count;                  ///< Number of triangles in a leaf, 0 for interior nodes.
+
+            bool
+                isLeaf() const { return count > 0; }
+        };
+
+        /**
+         * @brief Triangle in intersection-ready form.
+         */
+        struct
+            Triangle {
+            CVector3 v0;
+            CVector3 e1;
+            CVector3 e2;
+        };
+
+        /**
+         * @brief Maximum traversal depth supported by the fixed-size traversal stacks.
+         */
+        static constexpr int MAX_STACK = 64;
+
+        /**
+         * @brief Builds the hierarchy from an indexed triangle list.
+         * @param vertices Vertex positions.
+         * @param indices Three indices per triangle.
+         * @param triangleCount Number of triangles.
+         * @param maxLeafSize Maximum triangles per leaf.
+         */
+        void
+            build(const CVector3* vertices, const unsigned int* indices,
+                  std::size_t triangleCount, int maxLeafSize = 4) {
+            m_nodes.clear();
+            m_triangles.clear();
+            m_triangleIds.clear();
+            if (triangleCount == 0) return;
+
+            std::vector<AABB> bounds(triangleCount);
+            std::vector<CVector3> centroids(triangleCount);
+            m_triangleIds.resize(triangleCount);
+            for (std::size_t i = 0; i < triangleCount; ++i) {
+                const CVector3& a = vertices[indices[i * 3 + 0]];
+                const CVector3& b = vertices[indices[i * 3 + 1]];
+                const CVector3& c = vertices[indices[i * 3 + 2]];
+                bounds[i].expand(a);
+                bounds[i].expand(b);
+                bounds[i].expand(c);
+                centroids[i] = (a + b + c) * (1.f / 3.f);
+                m_triangleIds[i] = static_cast<int>(i);
+            }
+
+            m_nodes.reserve(triangleCount * 2);
+            m_nodes.push_back(Node());
+            subdivide(0, 0, static_cast<int>(triangleCount), bounds, centroids,
+                      maxLeafSize < 1 ? 1 : maxLeafSize, 0);
+
+            m_triangles.resize(triangleCount);
+            for (std::size_t i = 0; i < triangleCount; ++i) {
+                const int id = m_triangleIds[i];
+                const CVector3& a = vertices[indices[id * 3 + 0]];
+                const CVector3& b = vertices[indices[id * 3 + 1]];
+                const CVector3& c = vertices[indices[id * 3 + 2]];
+                m_triangles[i].v0 = a;
+                m_triangles[i].e1 = b - a;
+                m_triangles[i].e2 = c - a;
+            }
+        }
+
+        /**
+         * @brief Finds the closest hit along a single ray.
+         * @param ray Ray to trace.
+         * @param hit Output hit record (triangle holds the original triangle index).
+         * @return True if anything was hit.
+         */
+        bool
+            intersect(const Ray& ray, RayHit& hit) const {
+            hit = RayHit();
+            if (m_nodes.empty()) return false;
+
+            Ray r = ray;
+            const CVector3 invDir(safeInverse(r.direction.x), safeInverse(r.direction.y), safeInverse(r.direction.z));
+            int stack[MAX_STACK];
+            int top = 0;
+            stack[top++] = 0;
+            while (top > 0) {
+                const Node& node = m_nodes[stack[--top]];
+                float tNode;
+                if (!slab(node, r, invDir, tNode)) continue;
+
+                if (node.isLeaf()) {
+                    for (int i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                        const Triangle& tri = m_triangles[i];
+                        float t, u, v;
+                        if (intersectTriangle(r, tri.v0, tri.e1, tri.e2, t, u, v) && t < r.tMax) {
+                            r.tMax = t;
+                            hit.t = t;
+                            hit.u = u;
+                            hit.v = v;
+                            hit.triangle = m_triangleIds[i];
+                        }
+                    }
+                    continue;
+                }
+
+                // Visit the nearer child first so tMax shrinks early.
+                int nearChild = node.leftFirst;
+                int farChild = node.leftFirst + 1;
+                float dNear, dFar;
+                bool hitNear = slab(m_nodes[nearChild], r, invDir, dNear);
+                bool hitFar = slab(m_nodes[farChild], r, invDir, dFar);
+                if (hitFar && (!hitNear || dFar < dNear)) {
+                    std::swap(nearChild, farChild);
+                    std::swap(dNear, dFar);
+                    std::swap(hitNear, hitFar);
+                }
+                if (hitFar && top < MAX_STACK) stack[top++] = farChild;
+                if (hitNear && top < MAX_STACK) stack[top++] = nearChild;
+            }
+            return hit.hit();
+        }
+
+        /**
+         * @brief Any-hit query for visibility checks. Stops at the first hit found.
+         * @param ray Ray to trace; use Ray::fromSegment for point-to-point visibility.
+         * @return True if something blocks the ray inside [tMin, tMax].
+         */
+        bool
+            occluded(const Ray& ray) const {
+            if (m_nodes.empty()) return false;
+
+            const CVector3 invDir(safeInverse(ray.direction.x), safeInverse(ray.direction.y), safeInverse(ray.direction.z));
+            int stack[MAX_STACK];
+            int top = 0;
+            stack[top++] = 0;
+            while (top > 0) {
+                const Node& node = m_nodes[stack[--top]];
+                float tNode;
+                if (!slab(node, ray, invDir, tNode)) continue;
+
+                if (node.isLeaf()) {
+                    for (int i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                        const Triangle& tri = m_triangles[i];
+                        float t, u, v;
+                        if (intersectTriangle(ray, tri.v0, tri.e1, tri.e2, t, u, v)) return true;
+                    }
+                    continue;
+                }
+                if (top + 2 <= MAX_STACK) {
+                    stack[top++] = node.leftFirst + 1;
+                    stack[top++] = node.leftFirst;
+                }
+            }
+            return false;
+        }
+
+        /**
+         * @brief Closest-hit query for a packet of coherent rays. Each node is tested
+         *        against all rays at once and only skipped when every ray misses it.
+         * @param packet Packet to trace; hit records are written per lane.
+         * @return Bit mask of the lanes that hit something.
+         */
+        template<int N>
+        int
+            intersect(RayPacket<N>& packet) const {
+            if (m_nodes.empty()) return 0;
+
+            const int allLanes = (1 << N) - 1;
+            int hitMask = 0;
+            int stack[MAX_STACK];
+            int top = 0;
+            stack[top++] = 0;
+            while (top > 0) {
+                const Node& node = m_nodes[stack[--top]];
+                const int active = slab(node, packet, allLanes);
+                if (!active) continue;
+
+                if (node.isLeaf()) {
+                    for (int i = node.leftFirst; i < node.leftFirst + node.count; ++i) {
+                        const Triangle& tri = m_triangles[i];
+                        hitMask |= intersectTriangle(packet, tri.v0, tri.e1, tri.e2, m_triangleIds[i], active);
+                    }
+                    continue;
+                }
+                pushChildren(node, packet, stack, top);
+            }
+            return hitMask;
+        }
+
+        /**
+         * @brief Any-hit query for a packet. Lanes retire as soon as they are blocked and
+         *        traversal ends once every lane is resolved.
+         * @param packet Packet to trace. Hit records are not meaningful after this call.
+         * @return Bit mask of the occluded lanes.
+         */
+        template<int N>
+        int
+            occluded(RayPacket<N>& packet) const {
+            if (m_nodes.empty()) return 0;
+
+            int pending = 0;
+            for (int i = 0; i < N; ++i) {
+                if (packet.tMin[i] <= packet.tMax[i]) pending |= 1 << i;
+            }
+
+            int occludedMask = 0;
+            int stack[MAX_STACK];
+            int top = 0;
+            stack[top++] = 0;
+            while (top > 0 && pending) {
+                const Node& node = m_nodes[stack[--top]];
+                const int active = slab(node, packet, pending);
+                if (!active) continue;
+
+                if (node.isLeaf()) {
+                    for (int i = node.leftFirst; i < node.leftFirst + node.count && pending; ++i) {
+                        const Triangle& tri = m_triangles[i];
+                        const int blocked = intersectTriangle(packet, tri.v0, tri.e1, tri.e2, m_triangleIds[i], pending & active);
+                        occludedMask |= blocked;
+                        pending &= ~blocked;
+                    }
+                    continue;
+                }
+                pushChildren(node, packet, stack, top);
+            }
+            return occludedMask;
+        }
+
+        /**
+         * @brief Returns the bounds of the whole mesh.
+         */
+        AABB
+            bounds() const {
+            if (m_nodes.empty()) return AABB();
+            const Node& root = m_nodes[0];
+            return AABB(CVector3(root.minX, root.minY, root.minZ), CVector3(root.maxX, root.maxY, root.maxZ));
+        }
+
+        const std::vector<Node>&
+            nodes() const { return m_nodes; }
+
+        const std::vector<Triangle>&
+            triangles() const { return m_triangles; }
+
+    private:
+        static
+            float safeInverse(float d) {
+            if (Math::abs(d) < 1e-20f) d = d < 0.f ? -1e-20f : 1e-20f;
+            return 1.f / d;
+        }
+
+        /**
+         * @brief Scalar slab test against [r.tMin, r.tMax].
+         * @param tNear Entry distance, only written on a hit.
+         * @return True if the ray overlaps the node inside its interval.
+         */
+        static
+            bool slab(const Node& n, const Ray& r, const CVector3& inv, float& tNear) {
+            float tx1 = (n.minX - r.origin.x) * inv.x, tx2 = (n.maxX - r.origin.x) * inv.x;
+            float ty1 = (n.minY - r.origin.y) * inv.y, ty2 = (n.maxY - r.origin.y) * inv.y;
+            float tz1 = (n.minZ - r.origin.z) * inv.z, tz2 = (n.maxZ - r.origin.z) * inv.z;
+            const float tEnter = Math::EMax(Math::EMax(Math::EMin(tx1, tx2), Math::EMin(ty1, ty2)),
+                                           Math::EMax(Math::EMin(tz1, tz2), r.tMin));
+            const float tFar = Math::EMin(Math::EMin(Math::EMax(tx1, tx2), Math::EMax(ty1, ty2)),
+                                          Math::EMin(Math::EMax(tz1, tz2), r.tMax));
+            if (tEnter > tFar) return false;
+            tNear = tEnter;
+            return true;
+        }
+
+        /**
+         * @brief Packet slab test, 4 lanes per SIMD register.
+         * @return Bit mask of the lanes (restricted to laneMask) that overlap the node.
+         */
+        template<int N>
+        static
+            int slab(const Node& n, const RayPacket<N>& p, int laneMask) {
+            using SIMD::float4;
+            const float4 bMinX(n.minX), bMinY(n.minY), bMinZ(n.minZ);
+            const float4 bMaxX(n.maxX), bMaxY(n.maxY), bMaxZ(n.maxZ);
+
+            int mask = 0;
+            for (int b = 0; b < RayPacket<N>::BLOCKS; ++b) {
+                const int o = b * SIMD::LANES;
+                if (!((laneMask >> o) & 0xF)) continue;
+
+                const float4 ox = float4::load(p.ox + o), ix = float4::load(p.invDx + o);
+                const float4 oy = float4::load(p.oy + o), iy = float4::load(p.invDy + o);
+                const float4 oz = float4::load(p.oz + o), iz = float4::load(p.invDz + o);
+                const float4 tx1 = (bMinX - ox) * ix, tx2 = (bMaxX - ox) * ix;
+                const float4 ty1 = (bMinY - oy) * iy, ty2 = (bMaxY - oy) * iy;
+                const float4 tz1 = (bMinZ - oz) * iz, tz2 = (bMaxZ - oz) * iz;
+
+                const float4 tNear = SIMD::max(SIMD::max(SIMD::min(tx1, tx2), SIMD::min(ty1, ty2)),
+                                               SIMD::max(SIMD::min(tz1, tz2), float4::load(p.tMin + o)));
+                const float4 tFar = SIMD::min(SIMD::min(SIMD::max(tx1, tx2), SIMD::max(ty1, ty2)),
+                                              SIMD::min(SIMD::max(tz1, tz2), float4::load(p.tMax + o)));
+                mask |= SIMD::movemask(tNear <= tFar) << o;
+            }
+            return mask & laneMask;
+        }
+
+        /**
+         * @brief Pushes both children, ordered front-to-back along the packet's leading ray.
+         */
+        template<int N>
+        void
+            pushChildren(const Node& node, const RayPacket<N>& p, int* stack, int& top) const {
+            if (top + 2 > MAX_STACK) return;
+            const Node& l = m_nodes[node.leftFirst];
+            const Node& r = m_nodes[node.leftFirst + 1];
+            const float toRight =
+                ((r.minX + r.maxX) - (l.minX + l.maxX)) * p.dx[0] +
+                ((r.minY + r.maxY) - (l.minY + l.maxY)) * p.dy[0] +
+                ((r.minZ + r.maxZ) - (l.minZ + l.maxZ)) * p.dz[0];
+            if (toRight >= 0.f) {
+                stack[top++] = node.leftFirst + 1;
+                stack[top++] = node.leftFirst;
+            }
+            else {
+                stack[top++] = node.leftFirst;
+                stack[top++] = node.leftFirst + 1;
+            }
+        }
+
+        void
+            subdivide(int nodeIndex, int first, int count,
+                      const std::vector<AABB>& bounds, const std::vector<CVector3>& centroids,
+                      int maxLeafSize, int depth) {
+            AABB box;
+            AABB centroidBox;
+            for (int i = first; i < first + count; ++i) {
+                box.expand(bounds[m_triangleIds[i]]);
+                centroidBox.expand(centroids[m_triangleIds[i]]);
+            }
+            Node& node = m_nodes[nodeIndex];
+            node.minX = box.min.x; node.minY = box.min.y; node.minZ = box.min.z;
+            node.maxX = box.max.x; node.maxY = box.max.y; node.maxZ = box.max.z;
+
+            // Leaves also absorb degenerate splits and keep the depth within the stack size.
+            const int axis = centroidBox.longestAxis();
+            if (count <= maxLeafSize || depth >= MAX_STACK - 2 || centroidBox.extent()[axis] <= 0.f) {
+                node.leftFirst = first;
+                node.count = count;
+                return;
+            }
+
+            const int half = count / 2;
+            std::nth_element(m_triangleIds.begin() + first,
+                             m_triangleIds.begin() + first + half,
+                             m_triangleIds.begin() + first + count,
+                             [&centroids, axis](int a, int b) { return centroids[a][axis] < centroids[b][axis]; });
+
+            const int left = static_cast<int>(m_nodes.size());
+            m_nodes.push_back(Node());
+            m_nodes.push_back(Node());
+            m_nodes[nodeIndex].leftFirst = left;
+            m_nodes[nodeIndex].count = 0;
+            subdivide(left, first, half, bounds, centroids, maxLeafSize, depth + 1);
+            subdivide(left + 1, first + half, count - half, bounds, centroids, maxLeafSize, depth + 1);
+        }
+
+        std::vector<Node> m_nodes;
+        std::vector<Triangle> m_triangles;
+        std::vector<int> m_triangleIds;
+    };
+
+} // namespace EU
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <Vectors/Vector3.h>
+#include <Vectors/Vector4.h>
+#include <Matrices/Matrix4x4.h>
+#include <Geometry/AABB.h>
+#include <Math/EngineMath.h>
+
+/**
+ * @file Frustum.h
+ * @brief View frustum as six planes extracted from a view-projection matrix.
+ */
+
+namespace EU {
+
+    /**
+     * @class Frustum
+     * @brief Planes (a, b, c, d) with unit normals pointing inside: a point p is inside
+     *        a plane when a*p.x + b*p.y + c*p.z + d >= 0.
+     */
+    class
+        Frustum {
+    public:
+        enum
+            PlaneIndex {
+            LEFT, RIGHT, BOTTOM, TOP, NEAR_PLANE, FAR_PLANE, PLANE_COUNT
+        };
+
+        CVector4 planes[PLANE_COUNT];
+
+        /**
+         * @brief Default constructor. Every plane accepts everything.
+         */
+        Frustum() {
+            for (int i = 0; i < PLANE_COUNT; ++i) planes[i] = CVector4(0.f, 0.f, 0.f, 1.f);
+        }
+
+        /**
+         * @brief Gribb-Hartmann extraction: clip-space -w <= x, y, z <= w becomes
+         *        row3 +/- row0..2 of the matrix (column vectors, z in [-1, 1]).
+         * @param viewProjection World-to-clip matrix.
+         */
+        static Frustum
+            fromMatrix(const Matrix4x4& viewProjection) {
+            const float (&m)[4][4] = viewProjection.m;
+            Frustum f;
+            for (int axis = 0; axis < 3; ++axis) {
+                const float sign[2] = { 1.f, -1.f };
+                for (int side = 0; side < 2; ++side) {
+                    CVector4 p(m[3][0] + sign[side] * m[axis][0], m[3][1] + sign[side] * m[axis][1],
+                               m[3][2] + sign[side] * m[axis][2], m[3][3] + sign[side] * m[axis][3]);
+                    const float len = Math::sqrt(p.x * p.x + p.y * p.y + p.z * p.z);
+                    f.planes[axis * 2 + side] = len > 0.f ? p / len : p;
+                }
+            }
+            return f;
+        }
+
+        /**
+         * @brief Signed distance from a plane (positive inside).
+         */
+        float
+            distance(int plane, const CVector3& p) const {
+            const CVector4& pl = planes[plane];
+            return pl.x * p.x + pl.y * p.y + pl.z * p.z + pl.w;
+        }
+
+        bool
+            contains(const CVector3& p) const {
+            for (int i = 0; i < PLANE_COUNT; ++i) {
+                if (distance(i, p) < 0.f) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Conservative sphere test: false only if the sphere is fully outside
+         *        one plane.
+         */
+        bool
+            intersects(const CVector3& center, float radius) const {
+            for (int i = 0; i < PLANE_COUNT; ++i) {
+                if (distance(i, center) < -radius) return false;
+            }
+            return true;
+        }
+
+        /**
+         * @brief Conservative box test: for each plane only the corner farthest along
+         *        its normal is checked.
+         */
+        bool
+            intersects(const AABB& box) const {
+            for (int i = 0; i < PLANE_COUNT; ++i) {
+                const CVector4& pl = planes[i];
+                const CVector3 corner(pl.x >= 0.f ? box.max.x : box.min.x,
+                                      pl.y >= 0.f ? box.max.y : box.min.y,
+                                      pl.z >= 0.f ? box.max.z : box.min.z);
+                if (distance(i, corner) < 0.f) return false;
+            }
+            return true;
+        }
+    };
+
+} // namespace EU
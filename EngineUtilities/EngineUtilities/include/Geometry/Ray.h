@@ -0,0 +1,116 @@
+#pragma once
+
+#include <Vectors/Vector3.h>
+#include <Core/Constants.h>
+#include <Math/EngineMath.h>
+
+/**
+ * @file Ray.h
+ * @brief Single ray type and the scalar Moller-Trumbore ray/triangle test.
+ */
+
+namespace EU {
+
+    /**
+     * @class Ray
+     * @brief Half-line defined by an origin, a direction and a valid [tMin, tMax] interval.
+     */
+    class
+        Ray {
+    public:
+        CVector3 origin;
+        CVector3 direction;
+        float tMin;
+        float tMax;
+
+        /**
+         * @brief Default constructor. Ray at the origin pointing down +Z.
+         */
+        Ray() : origin(), direction(0.f, 0.f, 1.f), tMin(0.f), tMax(Constants::INF) {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param origin Start point of the ray.
+         * @param direction Direction of the ray (does not need to be normalized).
+         * @param tMin Closest accepted hit distance.
+         * @param tMax Farthest accepted hit distance.
+         */
+        Ray(const CVector3& origin, const CVector3& direction,
+            float tMin = 0.f, float tMax = Constants::INF)
+            : origin(origin), direction(direction), tMin(tMin), tMax(tMax) {
+        }
+
+        /**
+         * @brief Builds a segment ray between two points, with t in [0, 1].
+         * @param from Start point.
+         * @param to End point.
+         */
+        static
+            Ray fromSegment(const CVector3& from, const CVector3& to) {
+            return Ray(from, to - from, 0.f, 1.f);
+        }
+
+        /**
+         * @brief Evaluates the point at parameter t.
+         * @param t Ray parameter.
+         * @return origin + direction * t.
+         */
+        CVector3
+            at(float t) const {
+            return origin + direction * t;
+        }
+    };
+
+    /**
+     * @struct RayHit
+     * @brief Closest-hit record filled by the ray queries.
+     */
+    struct
+        RayHit {
+        float t = Constants::INF;   ///< Ray parameter of the hit.
+        float u = 0.f;              ///< Barycentric coordinate of v1.
+        float v = 0.f;              ///< Barycentric coordinate of v2.
+        int triangle = -1;          ///< Index of the triangle hit, -1 if none.
+
+        /**
+         * @brief True if a triangle was hit.
+         */
+        bool
+            hit() const {
+            return triangle >= 0;
+        }
+    };
+
+    /**
+     * @brief Moller-Trumbore ray/triangle intersection (double-sided).
+     * @param ray Ray to test; only hits inside [ray.tMin, ray.tMax] are reported.
+     * @param v0 First triangle vertex.
+     * @param e1 Edge v1 - v0.
+     * @param e2 Edge v2 - v0.
+     * @param t Output ray parameter.
+     * @param u Output barycentric coordinate of v1.
+     * @param v Output barycentric coordinate of v2.
+     * @return True if the ray hits the triangle.
+     */
+    inline
+        bool intersectTriangle(const Ray& ray,
+                               const CVector3& v0, const CVector3& e1, const CVector3& e2,
+                               float& t, float& u, float& v) {
+        CVector3 p = ray.direction.cross(e2);
+        float det = e1.dot(p);
+        if (Math::abs(det) < Constants::EPSILON * Constants::EPSILON) return false;
+
+        float invDet = 1.f / det;
+        CVector3 s = ray.origin - v0;
+        u = s.dot(p) * invDet;
+        if (u < 0.f || u > 1.f) return false;
+
+        CVector3 q = s.cross(e1);
+        v = ray.direction.dot(q) * invDet;
+        if (v < 0.f || u + v > 1.f) return false;
+
+        t = e2.dot(q) * invDet;
+        return t >= ray.tMin && t <= ray.tMax;
+    }
+
+} // namespace EU
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <Geometry/Ray.h>
+#include <Core/SIMD.h>
+#include <Core/Constants.h>
+
+/**
+ * @file RayPacket.h
+ * @brief Structure-of-arrays bundle of 4 or 8 coherent rays and the lane-parallel
+ *        Moller-Trumbore ray/triangle test.
+ */
+
+namespace EU {
+
+    /**
+     * @class RayPacket
+     * @brief N rays stored as separate component arrays so each SIMD register holds
+     *        the same component of 4 rays. Closest-hit queries shrink tMax in place.
+     * @tparam N Number of rays, a multiple of SIMD::LANES (4 or 8).
+     */
+    template<int N>
+    class
+        RayPacket {
+    public:
+        static_assert(N > 0 && N % SIMD::LANES == 0, "RayPacket size must be a multiple of the SIMD width");
+
+        /**
+         * @brief Number of SIMD registers needed per component.
+         */
+        static constexpr int BLOCKS = N / SIMD::LANES;
+
+        alignas(16) float ox[N];
+        alignas(16) float oy[N];
+        alignas(16) float oz[N];
+        alignas(16) float dx[N];
+        alignas(16) float dy[N];
+        alignas(16) float dz[N];
+        alignas(16) float invDx[N];
+        alignas(16) float invDy[N];
+        alignas(16) float invDz[N];
+        alignas(16) float tMin[N];
+        alignas(16) float tMax[N];
+        alignas(16) float u[N];
+        alignas(16) float v[N];
+        int triangle[N];
+
+        /**
+         * @brief Default constructor. All lanes start disabled.
+         */
+        RayPacket() {
+            for (int i = 0; i < N; ++i) {
+                ox[i] = oy[i] = oz[i] = 0.f;
+                dx[i] = dy[i] = 0.f;
+                dz[i] = 1.f;
+                invDx[i] = invDy[i] = Constants::INF;
+                invDz[i] = 1.f;
+                disable(i);
+            }
+        }
+
+        /**
+         * @brief Loads a ray into a lane and clears its hit record.
+         * @param lane Lane index in [0, N).
+         * @param ray Ray to store.
+         */
+        void
+            set(int lane, const Ray& ray) {
+            ox[lane] = ray.origin.x;
+            oy[lane] = ray.origin.y;
+            oz[lane] = ray.origin.z;
+            dx[lane] = ray.direction.x;
+            dy[lane] = ray.direction.y;
+            dz[lane] = ray.direction.z;
+            invDx[lane] = safeInverse(ray.direction.x);
+            invDy[lane] = safeInverse(ray.direction.y);
+            invDz[lane] = safeInverse(ray.direction.z);
+            tMin[lane] = ray.tMin;
+            tMax[lane] = ray.tMax;
+            u[lane] = 0.f;
+            v[lane] = 0.f;
+            triangle[lane] = -1;
+        }
+
+        /**
+         * @brief Deactivates a lane so it never reports hits (used to pad partial packets).
+         * @param lane Lane index in [0, N).
+         */
+        void
+            disable(int lane) {
+            tMin[lane] = Constants::INF;
+            tMax[lane] = Constants::NEG_INF;
+            u[lane] = 0.f;
+            v[lane] = 0.f;
+            triangle[lane] = -1;
+        }
+
+        /**
+         * @brief Returns the ray stored in a lane (tMax reflects the closest hit so far).
+         * @param lane Lane index in [0, N).
+         */
+        Ray
+            ray(int lane) const {
+            return Ray(CVector3(ox[lane], oy[lane], oz[lane]),
+                       CVector3(dx[lane], dy[lane], dz[lane]),
+                       tMin[lane], tMax[lane]);
+        }
+
+        /**
+         * @brief Returns the hit record of a lane.
+         * @param lane Lane index in [0, N).
+         */
+        RayHit
+            hit(int lane) const {
+            RayHit h;
+            if (triangle[lane] >= 0) {
+                h.t = tMax[lane];
+                h.u = u[lane];
+                h.v = v[lane];
+                h.triangle = triangle[lane];
+            }
+            return h;
+        }
+
+    private:
+        static
+            float safeInverse(float d) {
+            // Keeps the slab test free of 0 * inf NaNs for axis-aligned rays.
+            if (Math::abs(d) < 1e-20f) d = d < 0.f ? -1e-20f : 1e-20f;
+            return 1.f / d;
+        }
+    };
+
+    /**
+     * @brief Tests every active lane of a packet against one triangle (Moller-Trumbore
+     *        evaluated with cross/dot in SIMD lanes) and records closer hits.
+     * @param packet Packet to test; tMax, u, v and triangle are updated for lanes that hit.
+     * @param v0 First triangle vertex.
+     * @param e1 Edge v1 - v0.
+     * @param e2 Edge v2 - v0.
+     * @param triangleId Identifier written into the lanes that hit.
+     * @param activeMask Bit mask of lanes allowed to report hits.
+     * @return Bit mask of the lanes that hit this triangle.
+     */
+    template<int N>
+    inline
+        int intersectTriangle(RayPacket<N>& packet,
+                              const CVector3& v0, const CVector3& e1, const CVector3& e2,
+                              int triangleId, int activeMask = (1 << N) - 1) {
+        using SIMD::float4;
+
+        const float4 e1x(e1.x), e1y(e1.y), e1z(e1.z);
+        const float4 e2x(e2.x), e2y(e2.y), e2z(e2.z);
+        const float4 v0x(v0.x), v0y(v0.y), v0z(v0.z);
+        const float4 zero = float4::zero();
+        const float4 one(1.f);
+        const float4 eps(Constants::EPSILON * Constants::EPSILON);
+
+        int hitMask = 0;
+        for (int b = 0; b < RayPacket<N>::BLOCKS; ++b) {
+            const int laneBits = (activeMask >> (b * SIMD::LANES)) & 0xF;
+            if (!laneBits) continue;
+
+            const int o = b * SIMD::LANES;
+            const float4 dx = float4::load(packet.dx + o);
+            const float4 dy = float4::load(packet.dy + o);
+            const float4 dz = float4::load(packet.dz + o);
+
+            float4 px, py, pz;
+            SIMD::cross3(dx, dy, dz, e2x, e2y, e2z, px, py, pz);
+            const float4 det = SIMD::dot3(e1x, e1y, e1z, px, py, pz);
+            float4 valid = SIMD::abs(det) > eps;
+            const float4 invDet = one / det;
+
+            const float4 sx = float4::load(packet.ox + o) - v0x;
+            const float4 sy = float4::load(packet.oy + o) - v0y;
+            const float4 sz = float4::load(packet.oz + o) - v0z;
+            const float4 u = SIMD::dot3(sx, sy, sz, px, py, pz) * invDet;
+            valid = valid & (u >= zero) & (u <= one);
+
+            float4 qx, qy, qz;
+            SIMD::cross3(sx, sy, sz, e1x, e1y, e1z, qx, qy, qz);
+            const float4 v = SIMD::dot3(dx, dy, dz, qx, qy, qz) * invDet;
+            valid = valid & (v >= zero) & ((u + v) <= one);
+
+            const float4 t = SIMD::dot3(e2x, e2y, e2z, qx, qy, qz) * invDet;
+            const float4 tMax = float4::load(packet.tMax + o);
+            valid = valid & (t >= float4::load(packet.tMin + o)) & (t < tMax);
+            valid = valid & SIMD::maskFromBits(laneBits);
+
+            const int mask = SIMD::movemask(valid);
+            if (!mask) continue;
+
+            SIMD::select(valid, t, tMax).store(packet.tMax + o);
+            SIMD::select(valid, u, float4::load(packet.u + o)).store(packet.u + o);
+            SIMD::select(valid, v, float4::load(packet.v + o)).store(packet.v + o);
+            for (int i = 0; i < SIMD::LANES; ++i) {
+                if (mask & (1 << i)) packet.triangle[o + i] = triangleId;
+            }
+            hitMask |= mask << o;
+        }
+        return hitMask;
+    }
+
+} // namespace EU
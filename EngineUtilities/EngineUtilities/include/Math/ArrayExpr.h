@@ -0,0 +1,378 @@
+#pragma once
+
+#include <vector>
+#include <Core/SIMD.h>
+
+/**
+ * @file ArrayExpr.h
+ * @brief Opt-in expression templates over SoA float streams.
+ *
+ * An expression such as pos += vel * dt + acc * (0.5f * dt * dt) builds a small
+ * tree of node types instead of temporaries. It is evaluated when assigned to an
+ * Array or Array3, in one loop of SIMD::LANES wide packets with a scalar tail. An
+ * addition with a product on either side becomes a SIMD::madd (one FMA when
+ * available). Leaves do not carry a size: the destination's count is used, so
+ * every stream in the expression must be at least that long.
+ *
+ * Element-wise only: out[i] may depend on any in[i], so in-place updates are safe.
+ */
+
+namespace EU {
+    namespace ArrayExpr {
+
+        /**
+         * @brief CRTP base marking expression types, so the operators below only apply
+         *        to them.
+         */
+        template<class E>
+        struct
+            Expression {
+            const E&
+                self() const {
+                return static_cast<const E&>(*this);
+            }
+        };
+
+        /**
+         * @brief Read-only leaf over a float stream.
+         */
+        struct
+            Ref : Expression<Ref> {
+            const float* data;
+
+            explicit Ref(const float* data) : data(data) {}
+
+            SIMD::float4
+                packet(int i) const {
+                return SIMD::float4::loadu(data + i);
+            }
+
+            float
+                at(int i) const {
+                return data[i];
+            }
+        };
+
+        /**
+         * @brief Leaf broadcasting one value to every element.
+         */
+        struct
+            Scalar : Expression<Scalar> {
+            float value;
+
+            explicit Scalar(float value) : value(value) {}
+
+            SIMD::float4
+                packet(int) const {
+                return SIMD::float4(value);
+            }
+
+            float
+                at(int) const {
+                return value;
+            }
+        };
+
+        struct Add { template<class T> static T apply(const T& a, const T& b) { return a + b; } };
+        struct Sub { template<class T> static T apply(const T& a, const T& b) { return a - b; } };
+        struct Mul { template<class T> static T apply(const T& a, const T& b) { return a * b; } };
+        struct Div { template<class T> static T apply(const T& a, const T& b) { return a / b; } };
+
+        template<class Op, class L, class R>
+        struct Binary;
+
+        namespace detail {
+
+            // Sums with a product on either side are fused into one madd.
+
+            template<class L, class R>
+            inline SIMD::float4
+                sum(const L& l, const R& r, int i) {
+                return l.packet(i) + r.packet(i);
+            }
+
+            template<class A, class B, class R>
+            inline SIMD::float4
+                sum(const Binary<Mul, A, B>& l, const R& r, int i) {
+                return SIMD::madd(l.l.packet(i), l.r.packet(i), r.packet(i));
+            }
+
+            template<class L, class A, class B>
+            inline SIMD::float4
+                sum(const L& l, const Binary<Mul, A, B>& r, int i) {
+                return SIMD::madd(r.l.packet(i), r.r.packet(i), l.packet(i));
+            }
+
+            template<class A, class B, class C, class D>
+            inline SIMD::float4
+                sum(const Binary<Mul, A, B>& l, const Binary<Mul, C, D>& r, int i) {
+                return SIMD::madd(l.l.packet(i), l.r.packet(i), r.packet(i));
+            }
+
+            /**
+             * @brief Evaluates one packet of l Op r.
+             */
+            template<class Op>
+            struct
+                Packet {
+                template<class L, class R>
+                static SIMD::float4
+                    eval(const L& l, const R& r, int i) {
+                    return Op::apply(l.packet(i), r.packet(i));
+                }
+            };
+
+            template<>
+            struct
+                Packet<Add> {
+                template<class L, class R>
+                static SIMD::float4
+                    eval(const L& l, const R& r, int i) {
+                    return sum(l, r, i);
+                }
+            };
+
+        } // namespace detail
+
+        /**
+         * @brief Element-wise l Op r.
+         */
+        template<class Op, class L, class R>
+        struct
+            Binary : Expression<Binary<Op, L, R>> {
+            L l;
+            R r;
+
+            Binary(const L& l, const R& r) : l(l), r(r) {}
+
+            SIMD::float4
+                packet(int i) const {
+                return detail::Packet<Op>::eval(l, r, i);
+            }
+
+            float
+                at(int i) const {
+                return Op::apply(l.at(i), r.at(i));
+            }
+        };
+
+        /**
+         * @brief Writable stream of count floats; also usable as a leaf.
+         */
+        struct
+            Array : Expression<Array> {
+            float* data;
+            int count;
+
+            Array(float* data, int count) : data(data), count(count) {}
+
+            explicit Array(std::vector<float>& v) : data(v.data()), count(static_cast<int>(v.size())) {}
+
+            /**
+             * @brief Copies the view (pointer and count); expressions hold leaves by
+             *        value. Assignment below copies elements instead.
+             */
+            Array(const Array&) = default;
+
+            SIMD::float4
+                packet(int i) const {
+                return SIMD::float4::loadu(data + i);
+            }
+
+            float
+                at(int i) const {
+                return data[i];
+            }
+
+            /**
+             * @brief Copies the elements (not the pointer) of another array.
+             */
+            Array&
+                operator=(const Array& e) { return assign<Assign>(e); }
+
+            template<class E>
+            Array&
+                operator=(const Expression<E>& e) { return assign<Assign>(e.self()); }
+
+            template<class E>
+            Array&
+                operator+=(const Expression<E>& e) { return assign<Add>(e.self()); }
+
+            template<class E>
+            Array&
+                operator-=(const Expression<E>& e) { return assign<Sub>(e.self()); }
+
+            template<class E>
+            Array&
+                operator*=(const Expression<E>& e) { return assign<Mul>(e.self()); }
+
+            Array&
+                operator=(float v) { return assign<Assign>(Scalar(v)); }
+
+            Array&
+                operator+=(float v) { return assign<Add>(Scalar(v)); }
+
+            Array&
+                operator-=(float v) { return assign<Sub>(Scalar(v)); }
+
+            Array&
+                operator*=(float v) { return assign<Mul>(Scalar(v)); }
+
+        private:
+            struct Assign { template<class T> static T apply(const T&, const T& b) { return b; } };
+
+            template<class Op, class E>
+            Array&
+                assign(const E& e) {
+                int i = 0;
+                for (; i + SIMD::LANES <= count; i += SIMD::LANES) {
+                    detail::Packet<Op>::eval(*this, e, i).storeu(data + i);
+                }
+                for (; i < count; ++i) data[i] = Op::apply(data[i], e.at(i));
+                return *this;
+            }
+        };
+
+#define EU_ARRAY_EXPR_OPERATOR(op, Op)                                                          \
+        template<class L, class R>                                                              \
+        inline Binary<Op, L, R> operator op(const Expression<L>& l, const Expression<R>& r) {   \
+            return Binary<Op, L, R>(l.self(), r.self());                                        \
+        }                                                                                       \
+        template<class L>                                                                       \
+        inline Binary<Op, L, Scalar> operator op(const Expression<L>& l, float r) {             \
+            return Binary<Op, L, Scalar>(l.self(), Scalar(r));                                  \
+        }                                                                                       \
+        template<class R>                                                                       \
+        inline Binary<Op, Scalar, R> operator op(float l, const Expression<R>& r) {             \
+            return Binary<Op, Scalar, R>(Scalar(l), r.self());                                  \
+        }
+
+        EU_ARRAY_EXPR_OPERATOR(+, Add)
+        EU_ARRAY_EXPR_OPERATOR(-, Sub)
+        EU_ARRAY_EXPR_OPERATOR(*, Mul)
+        EU_ARRAY_EXPR_OPERATOR(/, Div)
+
+#undef EU_ARRAY_EXPR_OPERATOR
+
+        /**
+         * @brief a + (b - a) * t, evaluated as one madd per packet.
+         */
+        template<class A, class B, class T>
+        inline Binary<Add, A, Binary<Mul, Binary<Sub, B, A>, T>>
+            lerp(const Expression<A>& a, const Expression<B>& b, const Expression<T>& t) {
+            return a + (b - a) * t;
+        }
+
+        template<class A, class B>
+        inline Binary<Add, A, Binary<Mul, Binary<Sub, B, A>, Scalar>>
+            lerp(const Expression<A>& a, const Expression<B>& b, float t) {
+            return a + (b - a) * t;
+        }
+
+        // Three-component expressions (e.g. CVector3 quantities stored as x/y/z streams)
+
+        /**
+         * @brief One expression per component.
+         */
+        template<class X, class Y, class Z>
+        struct
+            Vector3Expression {
+            X x;
+            Y y;
+            Z z;
+
+            Vector3Expression(const X& x, const Y& y, const Z& z) : x(x), y(y), z(z) {}
+        };
+
+        /**
+         * @brief Three writable streams of count floats.
+         */
+        struct
+            Array3 : Vector3Expression<Array, Array, Array> {
+            Array3(float* x, float* y, float* z, int count)
+                : Vector3Expression<Array, Array, Array>(Array(x, count), Array(y, count), Array(z, count)) {}
+
+            /**
+             * @brief Copies the three views, like Array; assignment copies elements.
+             */
+            Array3(const Array3&) = default;
+
+            Array3&
+                operator=(const Array3& e) { x = e.x; y = e.y; z = e.z; return *this; }
+
+            template<class X, class Y, class Z>
+            Array3&
+                operator=(const Vector3Expression<X, Y, Z>& e) { x = e.x; y = e.y; z = e.z; return *this; }
+
+            template<class X, class Y, class Z>
+            Array3&
+                operator+=(const Vector3Expression<X, Y, Z>& e) { x += e.x; y += e.y; z += e.z; return *this; }
+
+            template<class X, class Y, class Z>
+            Array3&
+                operator-=(const Vector3Expression<X, Y, Z>& e) { x -= e.x; y -= e.y; z -= e.z; return *this; }
+
+            template<class E>
+            Array3&
+                operator*=(const Expression<E>& e) { x *= e; y *= e; z *= e; return *this; }
+
+            Array3&
+                operator*=(float v) { x *= v; y *= v; z *= v; return *this; }
+        };
+
+        template<class Op, class X, class Y, class Z, class U, class V, class W>
+        inline Vector3Expression<Binary<Op, X, U>, Binary<Op, Y, V>, Binary<Op, Z, W>>
+            componentwise(const Vector3Expression<X, Y, Z>& a, const Vector3Expression<U, V, W>& b) {
+            return Vector3Expression<Binary<Op, X, U>, Binary<Op, Y, V>, Binary<Op, Z, W>>(
+                Binary<Op, X, U>(a.x, b.x), Binary<Op, Y, V>(a.y, b.y), Binary<Op, Z, W>(a.z, b.z));
+        }
+
+        template<class Op, class X, class Y, class Z, class S>
+        inline Vector3Expression<Binary<Op, X, S>, Binary<Op, Y, S>, Binary<Op, Z, S>>
+            broadcast(const Vector3Expression<X, Y, Z>& a, const S& s) {
+            return Vector3Expression<Binary<Op, X, S>, Binary<Op, Y, S>, Binary<Op, Z, S>>(
+                Binary<Op, X, S>(a.x, s), Binary<Op, Y, S>(a.y, s), Binary<Op, Z, S>(a.z, s));
+        }
+
+        template<class X, class Y, class Z, class U, class V, class W>
+        inline Vector3Expression<Binary<Add, X, U>, Binary<Add, Y, V>, Binary<Add, Z, W>>
+            operator+(const Vector3Expression<X, Y, Z>& a, const Vector3Expression<U, V, W>& b) {
+            return componentwise<Add>(a, b);
+        }
+
+        template<class X, class Y, class Z, class U, class V, class W>
+        inline Vector3Expression<Binary<Sub, X, U>, Binary<Sub, Y, V>, Binary<Sub, Z, W>>
+            operator-(const Vector3Expression<X, Y, Z>& a, const Vector3Expression<U, V, W>& b) {
+            return componentwise<Sub>(a, b);
+        }
+
+        /**
+         * @brief Scales every component by a scalar stream (e.g. per-entity inverse mass).
+         */
+        template<class X, class Y, class Z, class S>
+        inline Vector3Expression<Binary<Mul, X, S>, Binary<Mul, Y, S>, Binary<Mul, Z, S>>
+            operator*(const Vector3Expression<X, Y, Z>& a, const Expression<S>& s) {
+            return broadcast<Mul>(a, s.self());
+        }
+
+        template<class X, class Y, class Z>
+        inline Vector3Expression<Binary<Mul, X, Scalar>, Binary<Mul, Y, Scalar>, Binary<Mul, Z, Scalar>>
+            operator*(const Vector3Expression<X, Y, Z>& a, float s) {
+            return broadcast<Mul>(a, Scalar(s));
+        }
+
+        template<class X, class Y, class Z>
+        inline Vector3Expression<Binary<Mul, X, Scalar>, Binary<Mul, Y, Scalar>, Binary<Mul, Z, Scalar>>
+            operator*(float s, const Vector3Expression<X, Y, Z>& a) {
+            return broadcast<Mul>(a, Scalar(s));
+        }
+
+        template<class A, class B, class C, class D, class E, class F>
+        inline auto
+            lerp(const Vector3Expression<A, B, C>& a, const Vector3Expression<D, E, F>& b, float t)
+            -> decltype(a + (b - a) * t) {
+            return a + (b - a) * t;
+        }
+
+    } // namespace ArrayExpr
+} // namespace EU
@@ -1,6 +1,7 @@
 ﻿#pragma once
 
 //#include "../Prerequisites.h" // Add this to Prerequisites
+#include <cstring>
 
 /**
  * @file EngineMath.h
@@ -14,14 +15,20 @@ namespace EU {
 
         /**
          * @brief Computes the square root using the Newton-Raphson method.
+         *        The first guess halves the exponent bits, so a few iterations
+         *        converge for any magnitude (x / 2 diverged far from 1).
          * @param x Input value.
          * @return Approximate square root.
          */
         inline
             float sqrt(float x) {
             if (x <= 0.f) return 0.f;
-            float guess = x / 2.f;
-            for (int i = 0; i < 10; ++i) {
+            unsigned int bits;
+            std::memcpy(&bits, &x, sizeof(bits));
+            bits = (bits >> 1) + 0x1FBD1DF5u;
+            float guess;
+            std::memcpy(&guess, &bits, sizeof(guess));
+            for (int i = 0; i < 3; ++i) {
                 guess = 0.5f * (guess + x / guess);
             }
             return guess;
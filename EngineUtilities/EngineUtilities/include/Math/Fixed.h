@@ -0,0 +1,431 @@
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+#include <Math/EngineMath.h>
+
+/**
+ * @file Fixed.h
+ * @brief Deterministic fixed-point scalars (Q16.16 and Q32.32) with table-based
+ *        trigonometry and exact integer square roots.
+ *
+ * Every operation is pure integer arithmetic, so results are bit-identical on
+ * every compiler, CPU and optimization level. Use these types for simulation
+ * state that must match across machines (lockstep multiplayer, replays) and
+ * convert to float only for rendering.
+ */
+
+namespace EU {
+
+    namespace detail {
+
+        /**
+         * @brief Minimal unsigned 128-bit integer for the Q32.32 products, quotients
+         *        and square roots (MSVC has no native 128-bit type).
+         */
+        struct
+            UInt128 {
+            std::uint64_t hi;
+            std::uint64_t lo;
+        };
+
+        inline UInt128
+            mul128(std::uint64_t a, std::uint64_t b) {
+            const std::uint64_t a0 = a & 0xFFFFFFFFu, a1 = a >> 32;
+            const std::uint64_t b0 = b & 0xFFFFFFFFu, b1 = b >> 32;
+            const std::uint64_t p00 = a0 * b0, p01 = a0 * b1, p10 = a1 * b0, p11 = a1 * b1;
+            const std::uint64_t middle = (p00 >> 32) + (p01 & 0xFFFFFFFFu) + (p10 & 0xFFFFFFFFu);
+            UInt128 r;
+            r.lo = (middle << 32) | (p00 & 0xFFFFFFFFu);
+            r.hi = p11 + (p01 >> 32) + (p10 >> 32) + (middle >> 32);
+            return r;
+        }
+
+        inline UInt128
+            add128(const UInt128& a, const UInt128& b) {
+            UInt128 r;
+            r.lo = a.lo + b.lo;
+            r.hi = a.hi + b.hi + (r.lo < a.lo ? 1u : 0u);
+            return r;
+        }
+
+        /**
+         * @brief Integer square root (floor) of a 128-bit value, one result bit per step.
+         */
+        inline std::uint64_t
+            sqrt128(const UInt128& v) {
+            std::uint64_t root = 0;
+            UInt128 rem = { 0, 0 };
+            for (int i = 63; i >= 0; --i) {
+                // rem = rem * 4 + next two bits of v.
+                const std::uint64_t pair = i >= 32 ? (v.hi >> ((i - 32) * 2)) & 3u : (v.lo >> (i * 2)) & 3u;
+                rem.hi = (rem.hi << 2) | (rem.lo >> 62);
+                rem.lo = (rem.lo << 2) | pair;
+                // trial = root * 4 + 1, at most 66 bits.
+                UInt128 trial;
+                trial.hi = root >> 62;
+                trial.lo = (root << 2) | 1u;
+                if (rem.hi > trial.hi || (rem.hi == trial.hi && rem.lo >= trial.lo)) {
+                    rem.hi = rem.hi - trial.hi - (rem.lo < trial.lo ? 1u : 0u);
+                    rem.lo -= trial.lo;
+                    root = (root << 1) | 1u;
+                }
+                else {
+                    root <<= 1;
+                }
+            }
+            return root;
+        }
+
+        // Raw arithmetic per storage type. Products round to nearest; quotients
+        // truncate toward zero; division by zero saturates.
+
+        inline std::int32_t
+            fixedMul(std::int32_t a, std::int32_t b, int fractionBits) {
+            const std::int64_t p = static_cast<std::int64_t>(a) * b;
+            return static_cast<std::int32_t>((p + (static_cast<std::int64_t>(1) << (fractionBits - 1))) >> fractionBits);
+        }
+
+        inline std::int32_t
+            fixedDiv(std::int32_t a, std::int32_t b, int fractionBits) {
+            if (b == 0) return a >= 0 ? INT32_MAX : INT32_MIN;
+            return static_cast<std::int32_t>(static_cast<std::int64_t>(a) * (static_cast<std::int64_t>(1) << fractionBits) / b);
+        }
+
+        inline std::int64_t
+            fixedMul(std::int64_t a, std::int64_t b, int fractionBits) {
+            const bool negative = (a < 0) != (b < 0);
+            const std::uint64_t ua = a < 0 ? 0 - static_cast<std::uint64_t>(a) : static_cast<std::uint64_t>(a);
+            const std::uint64_t ub = b < 0 ? 0 - static_cast<std::uint64_t>(b) : static_cast<std::uint64_t>(b);
+            UInt128 p = mul128(ua, ub);
+            const UInt128 half = { 0, static_cast<std::uint64_t>(1) << (fractionBits - 1) };
+            p = add128(p, half);
+            const std::uint64_t r = (p.lo >> fractionBits) | (p.hi << (64 - fractionBits));
+            return negative ? static_cast<std::int64_t>(0 - r) : static_cast<std::int64_t>(r);
+        }
+
+        inline std::int64_t
+            fixedDiv(std::int64_t a, std::int64_t b, int fractionBits) {
+            if (b == 0) return a >= 0 ? INT64_MAX : INT64_MIN;
+            const bool negative = (a < 0) != (b < 0);
+            const std::uint64_t ua = a < 0 ? 0 - static_cast<std::uint64_t>(a) : static_cast<std::uint64_t>(a);
+            const std::uint64_t ub = b < 0 ? 0 - static_cast<std::uint64_t>(b) : static_cast<std::uint64_t>(b);
+            // Restoring long division of (ua << fractionBits) by ub.
+            const UInt128 n = { ua >> (64 - fractionBits), ua << fractionBits };
+            std::uint64_t q = 0, rem = 0;
+            for (int i = 127; i >= 0; --i) {
+                const bool carry = (rem >> 63) != 0;
+                rem = (rem << 1) | ((i >= 64 ? n.hi >> (i - 64) : n.lo >> i) & 1u);
+                q <<= 1;
+                if (carry || rem >= ub) {
+                    rem -= ub;
+                    q |= 1u;
+                }
+            }
+            return negative ? static_cast<std::int64_t>(0 - q) : static_cast<std::int64_t>(q);
+        }
+
+        /**
+         * @brief sin over a quarter wave at 256 steps, in Q2.30. Literal values so the
+         *        table is identical everywhere (no libm at startup).
+         */
+        inline const std::int32_t*
+            sinTable() {
+            static const std::int32_t table[257] = {
+                0, 6588356, 13176464, 19764076, 26350943, 32936819, 39521455, 46104602,
+                52686014, 59265442, 65842639, 72417357, 78989349, 85558366, 92124163, 98686491,
+                105245103, 111799753, 118350194, 124896179, 131437462, 137973796, 144504935, 151030634,
+                157550647, 164064728, 170572633, 177074115, 183568930, 190056834, 196537583, 203010932,
+                209476638, 215934457, 222384147, 228825464, 235258165, 241682010, 248096755, 254502159,
+                260897982, 267283981, 273659918, 280025552, 286380643, 292724951, 299058239, 305380268,
+                311690799, 317989595, 324276419, 330551034, 336813204, 343062693, 349299266, 355522689,
+                361732726, 367929144, 374111709, 380280190, 386434353, 392573967, 398698801, 404808624,
+                410903207, 416982319, 423045732, 429093217, 435124548, 441139496, 447137835, 453119340,
+                459083786, 465030947, 470960600, 476872522, 482766489, 488642281, 494499676, 500338453,
+                506158392, 511959275, 517740883, 523502998, 529245404, 534967884, 540670223, 546352205,
+                552013618, 557654248, 563273883, 568872310, 574449320, 580004702, 585538248, 591049748,
+                596538995, 602005783, 607449906, 612871159, 618269338, 623644239, 628995660, 634323400,
+                639627258, 644907034, 650162530, 655393548, 660599890, 665781362, 670937767, 676068911,
+                681174602, 686254647, 691308855, 696337036, 701339000, 706314559, 711263525, 716185713,
+                721080937, 725949013, 730789757, 735602987, 740388522, 745146182, 749875788, 754577161,
+                759250125, 763894504, 768510122, 773096806, 777654384, 782182683, 786681534, 791150767,
+                795590213, 799999706, 804379079, 808728167, 813046808, 817334838, 821592095, 825818421,
+                830013654, 834177638, 838310216, 842411232, 846480531, 850517961, 854523370, 858496606,
+                862437520, 866345964, 870221790, 874064853, 877875009, 881652112, 885396022, 889106597,
+                892783698, 896427186, 900036924, 903612776, 907154608, 910662286, 914135678, 917574653,
+                920979082, 924348837, 927683790, 930983817, 934248793, 937478595, 940673101, 943832191,
+                946955747, 950043650, 953095785, 956112036, 959092290, 962036435, 964944360, 967815955,
+                970651112, 973449725, 976211688, 978936898, 981625251, 984276646, 986890984, 989468165,
+                992008094, 994510675, 996975812, 999403415, 1001793390, 1004145648, 1006460100, 1008736660,
+                1010975242, 1013175761, 1015338134, 1017462281, 1019548121, 1021595575, 1023604567, 1025575020,
+                1027506862, 1029400018, 1031254418, 1033069992, 1034846671, 1036584389, 1038283080, 1039942680,
+                1041563127, 1043144360, 1044686319, 1046188946, 1047652185, 1049075980, 1050460278, 1051805027,
+                1053110176, 1054375676, 1055601479, 1056787540, 1057933813, 1059040255, 1060106826, 1061133483,
+                1062120190, 1063066909, 1063973603, 1064840240, 1065666786, 1066453210, 1067199483, 1067905576,
+                1068571464, 1069197120, 1069782521, 1070327646, 1070832474, 1071296985, 1071721163, 1072104991,
+                1072448455, 1072751542, 1073014240, 1073236540, 1073418433, 1073559913, 1073660973, 1073721611,
+                1073741824
+            };
+            return table;
+        }
+
+        /**
+         * @brief sin of an angle given in 2^-32 turns, in Q2.30, with linear
+         *        interpolation between table entries.
+         */
+        inline std::int32_t
+            sinTurn(std::uint32_t turn) {
+            const std::uint32_t index = turn >> 22;             // 10 bits: quadrant and step.
+            const std::int64_t t = (turn >> 6) & 0xFFFFu;        // Position inside the step, Q16.
+            const std::uint32_t quadrant = index >> 8, i = index & 255u;
+            const std::int32_t* table = sinTable();
+            std::int32_t a, b;
+            if (quadrant & 1u) {
+                a = table[256 - i];
+                b = table[255 - i];
+            }
+            else {
+                a = table[i];
+                b = table[i + 1];
+            }
+            const std::int32_t v = a + static_cast<std::int32_t>((static_cast<std::int64_t>(b - a) * t) >> 16);
+            return quadrant & 2u ? -v : v;
+        }
+
+        /**
+         * @brief Converts an angle in radians with F fraction bits to 2^-32 turns:
+         *        radians * 2^32 / (2 pi). Only the low 32 bits of the product matter,
+         *        so wrapping unsigned arithmetic is exact.
+         */
+        template<int F>
+        inline std::uint32_t
+            toTurn(std::int64_t radians) {
+            const std::uint64_t invTwoPiQ32 = 683565276u;
+            return static_cast<std::uint32_t>((static_cast<std::uint64_t>(radians) * invTwoPiQ32) >> F);
+        }
+
+        /**
+         * @brief Converts a Q2.30 value to T with F fraction bits (rounding if F < 30).
+         */
+        template<class T, int F>
+        inline T
+            fromQ30(std::int64_t v) {
+            return F >= 30 ? static_cast<T>(v * (static_cast<std::int64_t>(1) << (F >= 30 ? F - 30 : 0)))
+                           : static_cast<T>((v + (static_cast<std::int64_t>(1) << (F < 30 ? 29 - F : 0))) >> (F < 30 ? 30 - F : 0));
+        }
+
+    } // namespace detail
+
+    /**
+     * @class Fixed
+     * @brief Signed fixed-point number stored as T with FRACTION_BITS fraction bits.
+     *
+     * Use the Fixed32 (Q16.16, range +-32768, step 1.5e-5) and Fixed64 (Q32.32)
+     * typedefs. Addition and subtraction wrap on overflow; multiplication rounds to
+     * nearest; division truncates toward zero and saturates on division by zero.
+     */
+    template<class T, int FRACTION_BITS>
+    class
+        Fixed {
+        typedef typename std::make_unsigned<T>::type Unsigned;
+
+    public:
+        typedef T Raw;
+
+        static constexpr int FRACTION = FRACTION_BITS;
+
+        /**
+         * @brief Default constructor. Initializes to 0.
+         */
+        Fixed() : m_raw(0) {}
+
+        /**
+         * @brief Exact conversion from an integer.
+         */
+        Fixed(int value) : m_raw(static_cast<T>(static_cast<Unsigned>(static_cast<T>(value)) << FRACTION_BITS)) {}
+
+        /**
+         * @brief Rounds a float to the nearest representable value. Deterministic for a
+         *        given float, but prefer integers or fromRaw() for simulation constants.
+         */
+        explicit Fixed(float value) : Fixed(static_cast<double>(value)) {}
+
+        explicit Fixed(double value)
+            : m_raw(static_cast<T>(value * static_cast<double>(static_cast<T>(1) << FRACTION_BITS) + (value >= 0.0 ? 0.5 : -0.5))) {}
+
+        /**
+         * @brief Builds a value from its raw representation.
+         */
+        static Fixed
+            fromRaw(T raw) {
+            Fixed f;
+            f.m_raw = raw;
+            return f;
+        }
+
+        T
+            raw() const {
+            return m_raw;
+        }
+
+        float
+            toFloat() const {
+            return static_cast<float>(toDouble());
+        }
+
+        double
+            toDouble() const {
+            return static_cast<double>(m_raw) / static_cast<double>(static_cast<T>(1) << FRACTION_BITS);
+        }
+
+        /**
+         * @brief Integer part, rounded toward negative infinity.
+         */
+        int
+            toInt() const {
+            return static_cast<int>(m_raw >> FRACTION_BITS);
+        }
+
+        // Arithmetic operators
+        Fixed
+            operator+(const Fixed& other) const {
+            return fromRaw(static_cast<T>(static_cast<Unsigned>(m_raw) + static_cast<Unsigned>(other.m_raw)));
+        }
+
+        Fixed
+            operator-(const Fixed& other) const {
+            return fromRaw(static_cast<T>(static_cast<Unsigned>(m_raw) - static_cast<Unsigned>(other.m_raw)));
+        }
+
+        Fixed
+            operator-() const {
+            return fromRaw(static_cast<T>(0 - static_cast<Unsigned>(m_raw)));
+        }
+
+        Fixed
+            operator*(const Fixed& other) const {
+            return fromRaw(detail::fixedMul(m_raw, other.m_raw, FRACTION_BITS));
+        }
+
+        Fixed
+            operator/(const Fixed& other) const {
+            return fromRaw(detail::fixedDiv(m_raw, other.m_raw, FRACTION_BITS));
+        }
+
+        /**
+         * @brief Exact multiplication by an integer (no rounding).
+         */
+        Fixed
+            operator*(int scalar) const {
+            return fromRaw(static_cast<T>(static_cast<Unsigned>(m_raw) * static_cast<Unsigned>(static_cast<T>(scalar))));
+        }
+
+        Fixed
+            operator/(int divisor) const {
+            if (divisor == 0) return fromRaw(detail::fixedDiv(m_raw, static_cast<T>(0), FRACTION_BITS));
+            return fromRaw(static_cast<T>(m_raw / divisor));
+        }
+
+        // Compound assignment operators
+        Fixed& operator+=(const Fixed& other) { return *this = *this + other; }
+        Fixed& operator-=(const Fixed& other) { return *this = *this - other; }
+        Fixed& operator*=(const Fixed& other) { return *this = *this * other; }
+        Fixed& operator/=(const Fixed& other) { return *this = *this / other; }
+
+        // Comparison operators
+        bool operator==(const Fixed& other) const { return m_raw == other.m_raw; }
+        bool operator!=(const Fixed& other) const { return m_raw != other.m_raw; }
+        bool operator<(const Fixed& other) const { return m_raw < other.m_raw; }
+        bool operator<=(const Fixed& other) const { return m_raw <= other.m_raw; }
+        bool operator>(const Fixed& other) const { return m_raw > other.m_raw; }
+        bool operator>=(const Fixed& other) const { return m_raw >= other.m_raw; }
+
+        // Constants
+
+        static Fixed zero() { return Fixed(); }
+        static Fixed one() { return Fixed(1); }
+
+        /**
+         * @brief Smallest positive value (one raw step).
+         */
+        static Fixed epsilon() { return fromRaw(1); }
+
+        static Fixed pi() { return fromRaw(static_cast<T>(PI_Q32 >> (32 - FRACTION_BITS))); }
+        static Fixed halfPi() { return fromRaw(static_cast<T>((PI_Q32 / 2) >> (32 - FRACTION_BITS))); }
+        static Fixed twoPi() { return fromRaw(static_cast<T>((PI_Q32 * 2) >> (32 - FRACTION_BITS))); }
+
+    private:
+        static constexpr std::int64_t PI_Q32 = 13493037705LL;      ///< round(pi * 2^32).
+
+        T m_raw;
+    };
+
+    /**
+     * @brief Q16.16 in 32 bits.
+     */
+    typedef Fixed<std::int32_t, 16> Fixed32;
+
+    /**
+     * @brief Q32.32 in 64 bits.
+     */
+    typedef Fixed<std::int64_t, 32> Fixed64;
+
+    namespace Math {
+
+        template<class T, int F>
+        inline Fixed<T, F>
+            abs(const Fixed<T, F>& x) {
+            return x < Fixed<T, F>() ? -x : x;
+        }
+
+        /**
+         * @brief Exact square root (floor of the true result at this precision).
+         *        Negative inputs return 0.
+         */
+        template<class T, int F>
+        inline Fixed<T, F>
+            sqrt(const Fixed<T, F>& x) {
+            if (x.raw() <= 0) return Fixed<T, F>();
+            const std::uint64_t r = static_cast<std::uint64_t>(x.raw());
+            // sqrt(raw * 2^F) keeps F fraction bits in the result.
+            const detail::UInt128 shifted = { F == 0 ? 0 : r >> (64 - F), r << F };
+            return Fixed<T, F>::fromRaw(static_cast<T>(detail::sqrt128(shifted)));
+        }
+
+        /**
+         * @brief sqrt(a^2 + b^2 + c^2 + d^2) without intermediate overflow, for vector
+         *        and quaternion lengths.
+         */
+        template<class T, int F>
+        inline Fixed<T, F>
+            hypot(const Fixed<T, F>& a, const Fixed<T, F>& b,
+                  const Fixed<T, F>& c = Fixed<T, F>(), const Fixed<T, F>& d = Fixed<T, F>()) {
+            detail::UInt128 sum = { 0, 0 };
+            const T parts[4] = { a.raw(), b.raw(), c.raw(), d.raw() };
+            for (int i = 0; i < 4; ++i) {
+                const std::uint64_t u = parts[i] < 0 ? 0 - static_cast<std::uint64_t>(parts[i]) : static_cast<std::uint64_t>(parts[i]);
+                sum = detail::add128(sum, detail::mul128(u, u));
+            }
+            // The squares carry 2F fraction bits, so the root has F.
+            return Fixed<T, F>::fromRaw(static_cast<T>(detail::sqrt128(sum)));
+        }
+
+        /**
+         * @brief Sine of an angle in radians, from a 1024-step table with linear
+         *        interpolation (error below 5e-6).
+         */
+        template<class T, int F>
+        inline Fixed<T, F>
+            sin(const Fixed<T, F>& radians) {
+            return Fixed<T, F>::fromRaw(detail::fromQ30<T, F>(detail::sinTurn(detail::toTurn<F>(radians.raw()))));
+        }
+
+        template<class T, int F>
+        inline Fixed<T, F>
+            cos(const Fixed<T, F>& radians) {
+            return Fixed<T, F>::fromRaw(detail::fromQ30<T, F>(detail::sinTurn(detail::toTurn<F>(radians.raw()) + 0x40000000u)));
+        }
+
+    } // namespace Math
+
+} // namespace EU
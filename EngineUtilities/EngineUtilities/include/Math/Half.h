@@ -0,0 +1,303 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <Core/SIMD.h>
+
+/**
+ * @file Half.h
+ * @brief IEEE half-precision and 16-bit normalized scalars, with bulk conversion
+ *        of float arrays eight values per iteration.
+ *
+ * The bulk routines use F16C when the target has it (EU_SIMD_F16C) and an exact
+ * SSE2 emulation otherwise; both round to nearest even and produce the same bits
+ * as the scalar functions, including subnormals and infinities (NaN payloads may
+ * differ with F16C).
+ */
+
+namespace EU {
+
+    /**
+     * @struct half
+     * @brief IEEE 754 binary16 storage: 1 sign, 5 exponent, 10 mantissa bits. Range
+     *        +-65504, about 3 decimal digits. Meant for storage, not arithmetic.
+     */
+    struct
+        half {
+        std::uint16_t bits;
+
+        half() : bits(0) {}
+
+        /**
+         * @brief Rounds a float to the nearest half (ties to even).
+         */
+        explicit half(float value);
+
+        float
+            toFloat() const;
+
+        static half
+            fromBits(std::uint16_t b) {
+            half h;
+            h.bits = b;
+            return h;
+        }
+    };
+
+    namespace Packing {
+
+        namespace detail {
+            inline std::uint32_t floatBits(float f) { std::uint32_t u; std::memcpy(&u, &f, sizeof(u)); return u; }
+            inline float bitsFloat(std::uint32_t u) { float f; std::memcpy(&f, &u, sizeof(f)); return f; }
+        }
+
+        /**
+         * @brief float to half bits, round to nearest even.
+         */
+        inline std::uint16_t
+            floatToHalf(float value) {
+            std::uint32_t u = detail::floatBits(value);
+            const std::uint32_t sign = u & 0x80000000u;
+            u ^= sign;
+            std::uint32_t o;
+            if (u >= (127u + 16u) << 23) {
+                // Too large for a half (or inf / NaN); NaN keeps a quiet bit.
+                o = u > 0x7F800000u ? 0x7E00u : 0x7C00u;
+            }
+            else if (u < (113u << 23)) {
+                // Subnormal half: let the FPU align and round the mantissa.
+                const std::uint32_t magic = ((127u - 15u) + (23u - 10u) + 1u) << 23;
+                o = detail::floatBits(detail::bitsFloat(u) + detail::bitsFloat(magic)) - magic;
+            }
+            else {
+                const std::uint32_t mantOdd = (u >> 13) & 1u;
+                u += ((15u - 127u) << 23) + 0xFFFu;
+                u += mantOdd;
+                o = u >> 13;
+            }
+            return static_cast<std::uint16_t>(o | (sign >> 16));
+        }
+
+        /**
+         * @brief half bits to float (exact).
+         */
+        inline float
+            halfToFloat(std::uint16_t h) {
+            const std::uint32_t shiftedExp = 0x7C00u << 13;
+            std::uint32_t o = (h & 0x7FFFu) << 13;
+            const std::uint32_t exp = shiftedExp & o;
+            o += (127u - 15u) << 23;
+            if (exp == shiftedExp) {
+                o += (128u - 16u) << 23;            // Inf / NaN.
+            }
+            else if (exp == 0) {
+                o += 1u << 23;                      // Subnormal: renormalize.
+                o = detail::floatBits(detail::bitsFloat(o) - detail::bitsFloat(113u << 23));
+            }
+            return detail::bitsFloat(o | (static_cast<std::uint32_t>(h & 0x8000u) << 16));
+        }
+
+        /**
+         * @brief [-1, 1] to a signed 16-bit integer (clamped, rounded to nearest).
+         */
+        inline std::int16_t
+            floatToSnorm16(float value) {
+            value = value < -1.f ? -1.f : (value > 1.f ? 1.f : value);
+            const float scaled = value * 32767.f;
+            return static_cast<std::int16_t>(scaled < 0.f ? scaled - 0.5f : scaled + 0.5f);
+        }
+
+        inline float
+            snorm16ToFloat(std::int16_t value) {
+            const float f = static_cast<float>(value) * (1.f / 32767.f);
+            return f < -1.f ? -1.f : f;
+        }
+
+        /**
+         * @brief [0, 1] to an unsigned 16-bit integer (clamped, rounded to nearest).
+         */
+        inline std::uint16_t
+            floatToUnorm16(float value) {
+            value = value < 0.f ? 0.f : (value > 1.f ? 1.f : value);
+            return static_cast<std::uint16_t>(value * 65535.f + 0.5f);
+        }
+
+        inline float
+            unorm16ToFloat(std::uint16_t value) {
+            return static_cast<float>(value) * (1.f / 65535.f);
+        }
+
+#if EU_SIMD_SSE
+        namespace detail {
+
+            /**
+             * @brief Four floats to halves, one per 32-bit lane (sign-extended so that
+             *        _mm_packs_epi32 narrows them without saturating).
+             */
+            inline __m128i
+                floatToHalf4(__m128 f) {
+#if EU_SIMD_F16C
+                return _mm_cvtepi16_epi32(_mm_cvtps_ph(f, _MM_FROUND_TO_NEAREST_INT));
+#else
+                // Same three paths as the scalar floatToHalf(), selected per lane.
+                const __m128 sign = _mm_and_ps(f, _mm_set1_ps(-0.f));
+                const __m128 absf = _mm_xor_ps(f, sign);
+                const __m128i u = _mm_castps_si128(absf);
+                const __m128i magic = _mm_set1_epi32(((127 - 15) + (23 - 10) + 1) << 23);
+
+                const __m128i isNan = _mm_castps_si128(_mm_cmpunord_ps(absf, absf));
+                const __m128i isRegular = _mm_cmpgt_epi32(_mm_set1_epi32((127 + 16) << 23), u);
+                const __m128i infOrNan = _mm_or_si128(_mm_and_si128(isNan, _mm_set1_epi32(0x200)), _mm_set1_epi32(0x7C00));
+                const __m128i isSubnormal = _mm_cmpgt_epi32(_mm_set1_epi32(113 << 23), u);
+
+                const __m128i subnormal = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(absf, _mm_castsi128_ps(magic))), magic);
+                const __m128i mantOdd = _mm_srai_epi32(_mm_slli_epi32(u, 31 - 13), 31);
+                const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(_mm_add_epi32(u, _mm_set1_epi32(0xFFF - ((127 - 15) << 23))), mantOdd), 13);
+
+                const __m128i finite = _mm_or_si128(_mm_and_si128(isSubnormal, subnormal), _mm_andnot_si128(isSubnormal, normal));
+                const __m128i joined = _mm_or_si128(_mm_and_si128(isRegular, finite), _mm_andnot_si128(isRegular, infOrNan));
+                // Arithmetic shift: negative lanes become small negative int32 values, which
+                // the signed saturating pack keeps bit-exact in the low 16 bits.
+                return _mm_or_si128(joined, _mm_srai_epi32(_mm_castps_si128(sign), 16));
+#endif
+            }
+
+            /**
+             * @brief Four halves in the low 64 bits to floats.
+             */
+            inline __m128
+                halfToFloat4(__m128i packed) {
+#if EU_SIMD_F16C
+                return _mm_cvtph_ps(packed);
+#else
+                const __m128i h = _mm_unpacklo_epi16(packed, _mm_setzero_si128());
+                const __m128i expMant = _mm_and_si128(h, _mm_set1_epi32(0x7FFF));
+                const __m128i sign = _mm_slli_epi32(_mm_xor_si128(h, expMant), 16);
+                // Rebias by multiplying with 2^112: handles subnormals exactly.
+                const __m128 scaled = _mm_mul_ps(_mm_castsi128_ps(_mm_slli_epi32(expMant, 13)),
+                                                 _mm_castsi128_ps(_mm_set1_epi32((254 - 15) << 23)));
+                const __m128i wasInfNan = _mm_cmpgt_epi32(expMant, _mm_set1_epi32(0x7BFF));
+                const __m128 infNanExp = _mm_and_ps(_mm_castsi128_ps(wasInfNan), _mm_castsi128_ps(_mm_set1_epi32(255 << 23)));
+                return _mm_or_ps(_mm_or_ps(scaled, _mm_castsi128_ps(sign)), infNanExp);
+#endif
+            }
+
+            /**
+             * @brief Rounds to the nearest integer, ties away from zero (as the scalar code).
+             */
+            inline __m128i
+                roundToInt(__m128 v) {
+                const __m128 bias = _mm_or_ps(_mm_set1_ps(0.5f), _mm_and_ps(v, _mm_set1_ps(-0.f)));
+                return _mm_cvttps_epi32(_mm_add_ps(v, bias));
+            }
+
+        } // namespace detail
+#endif
+
+        /**
+         * @brief Converts count floats to half bits.
+         */
+        inline void
+            floatToHalf(const float* in, std::uint16_t* out, int count) {
+            int i = 0;
+#if EU_SIMD_SSE
+            for (; i + 8 <= count; i += 8) {
+                const __m128i lo = detail::floatToHalf4(_mm_loadu_ps(in + i));
+                const __m128i hi = detail::floatToHalf4(_mm_loadu_ps(in + i + 4));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(lo, hi));
+            }
+#endif
+            for (; i < count; ++i) out[i] = floatToHalf(in[i]);
+        }
+
+        /**
+         * @brief Converts count half bits to floats.
+         */
+        inline void
+            halfToFloat(const std::uint16_t* in, float* out, int count) {
+            int i = 0;
+#if EU_SIMD_SSE
+            for (; i + 8 <= count; i += 8) {
+                const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                _mm_storeu_ps(out + i, detail::halfToFloat4(h));
+                _mm_storeu_ps(out + i + 4, detail::halfToFloat4(_mm_srli_si128(h, 8)));
+            }
+#endif
+            for (; i < count; ++i) out[i] = halfToFloat(in[i]);
+        }
+
+        inline void
+            floatToSnorm16(const float* in, std::int16_t* out, int count) {
+            int i = 0;
+#if EU_SIMD_SSE
+            const __m128 lo = _mm_set1_ps(-1.f), hi = _mm_set1_ps(1.f), scale = _mm_set1_ps(32767.f);
+            for (; i + 8 <= count; i += 8) {
+                const __m128 a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i), lo), hi), scale);
+                const __m128 b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i + 4), lo), hi), scale);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_packs_epi32(detail::roundToInt(a), detail::roundToInt(b)));
+            }
+#endif
+            for (; i < count; ++i) out[i] = floatToSnorm16(in[i]);
+        }
+
+        inline void
+            snorm16ToFloat(const std::int16_t* in, float* out, int count) {
+            int i = 0;
+#if EU_SIMD_SSE
+            const __m128 scale = _mm_set1_ps(1.f / 32767.f), lo = _mm_set1_ps(-1.f);
+            for (; i + 8 <= count; i += 8) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                // Sign-extend: interleave into the high halves, then shift back down.
+                const __m128i a = _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+                const __m128i b = _mm_srai_epi32(_mm_unpackhi_epi16(v, v), 16);
+                _mm_storeu_ps(out + i, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(a), scale), lo));
+                _mm_storeu_ps(out + i + 4, _mm_max_ps(_mm_mul_ps(_mm_cvtepi32_ps(b), scale), lo));
+            }
+#endif
+            for (; i < count; ++i) out[i] = snorm16ToFloat(in[i]);
+        }
+
+        inline void
+            floatToUnorm16(const float* in, std::uint16_t* out, int count) {
+            int i = 0;
+#if EU_SIMD_SSE
+            const __m128 lo = _mm_setzero_ps(), hi = _mm_set1_ps(1.f), scale = _mm_set1_ps(65535.f);
+            // SSE2 has no unsigned pack: bias into the signed range, pack, flip the top bit.
+            const __m128i bias = _mm_set1_epi32(32768);
+            for (; i + 8 <= count; i += 8) {
+                const __m128 a = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i), lo), hi), scale);
+                const __m128 b = _mm_mul_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(in + i + 4), lo), hi), scale);
+                const __m128i packed = _mm_packs_epi32(_mm_sub_epi32(detail::roundToInt(a), bias),
+                                                       _mm_sub_epi32(detail::roundToInt(b), bias));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), _mm_xor_si128(packed, _mm_set1_epi16(static_cast<short>(0x8000))));
+            }
+#endif
+            for (; i < count; ++i) out[i] = floatToUnorm16(in[i]);
+        }
+
+        inline void
+            unorm16ToFloat(const std::uint16_t* in, float* out, int count) {
+            int i = 0;
+#if EU_SIMD_SSE
+            const __m128 scale = _mm_set1_ps(1.f / 65535.f);
+            const __m128i zero = _mm_setzero_si128();
+            for (; i + 8 <= count; i += 8) {
+                const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + i));
+                _mm_storeu_ps(out + i, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(v, zero)), scale));
+                _mm_storeu_ps(out + i + 4, _mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(v, zero)), scale));
+            }
+#endif
+            for (; i < count; ++i) out[i] = unorm16ToFloat(in[i]);
+        }
+
+    } // namespace Packing
+
+    inline
+        half::half(float value) : bits(Packing::floatToHalf(value)) {}
+
+    inline float
+        half::toFloat() const {
+        return Packing::halfToFloat(bits);
+    }
+
+} // namespace EU
@@ -0,0 +1,229 @@
+#pragma once
+
+#include <Vectors/Vector3.h>
+#include <Rotations/Quaternion.h>
+#include <Matrices/Matrix4x4.h>
+
+/**
+ * @file Transform.h
+ * @brief Translation-rotation-scale transform with a lazily cached Matrix4x4 and
+ *        inverse.
+ *
+ * Setters only mark the cached matrices dirty; getMatrix() and getInverseMatrix()
+ * rebuild them on first use after a change. Both are built directly from the
+ * components (the inverse is S^-1 * R^T * T(-p), no general 4x4 inversion). Points,
+ * composition and inversion can also be done on the TRS form without any matrix.
+ */
+
+namespace EU {
+
+    /**
+     * @class Transform
+     * @brief M = T(position) * R(rotation) * S(scale), applied to column vectors.
+     */
+    class
+        Transform {
+    public:
+        /**
+         * @brief Default constructor. Identity transform.
+         */
+        Transform()
+            : m_position(0.f, 0.f, 0.f), m_rotation(Quaternion::identity()), m_scale(1.f, 1.f, 1.f),
+              m_dirty(MATRIX_DIRTY | INVERSE_DIRTY) {
+        }
+
+        /**
+         * @param rotation Normalized on construction.
+         */
+        Transform(const CVector3& position, const Quaternion& rotation, const CVector3& scale = CVector3(1.f, 1.f, 1.f))
+            : m_position(position), m_rotation(rotation.normalized()), m_scale(scale),
+              m_dirty(MATRIX_DIRTY | INVERSE_DIRTY) {
+        }
+
+        // Components
+
+        const CVector3&
+            getPosition() const { return m_position; }
+
+        const Quaternion&
+            getRotation() const { return m_rotation; }
+
+        const CVector3&
+            getScale() const { return m_scale; }
+
+        void
+            setPosition(const CVector3& position) {
+            m_position = position;
+            m_dirty = MATRIX_DIRTY | INVERSE_DIRTY;
+        }
+
+        /**
+         * @param rotation Normalized before it is stored.
+         */
+        void
+            setRotation(const Quaternion& rotation) {
+            m_rotation = rotation.normalized();
+            m_dirty = MATRIX_DIRTY | INVERSE_DIRTY;
+        }
+
+        void
+            setScale(const CVector3& scale) {
+            m_scale = scale;
+            m_dirty = MATRIX_DIRTY | INVERSE_DIRTY;
+        }
+
+        /**
+         * @brief Adds offset to the position.
+         */
+        void
+            move(const CVector3& offset) {
+            setPosition(m_position + offset);
+        }
+
+        /**
+         * @brief Applies rotation after the current one.
+         */
+        void
+            rotate(const Quaternion& rotation) {
+            setRotation(rotation * m_rotation);
+        }
+
+        // Cached matrices
+
+        /**
+         * @brief Local-to-parent matrix, rebuilt only if a component changed.
+         */
+        const Matrix4x4&
+            getMatrix() const {
+            if (m_dirty & MATRIX_DIRTY) {
+                const Matrix3x3 r = m_rotation.toMatrix();
+                const float s[3] = { m_scale.x, m_scale.y, m_scale.z };
+                const float p[3] = { m_position.x, m_position.y, m_position.z };
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = 0; j < 3; ++j) m_matrix.m[i][j] = r.m[i][j] * s[j];
+                    m_matrix.m[i][3] = p[i];
+                    m_matrix.m[3][i] = 0.f;
+                }
+                m_matrix.m[3][3] = 1.f;
+                m_dirty &= ~MATRIX_DIRTY;
+            }
+            return m_matrix;
+        }
+
+        /**
+         * @brief Parent-to-local matrix, rebuilt only if a component changed. A zero
+         *        scale component maps that axis to 0.
+         */
+        const Matrix4x4&
+            getInverseMatrix() const {
+            if (m_dirty & INVERSE_DIRTY) {
+                const Matrix3x3 r = m_rotation.toMatrix();
+                const float s[3] = { m_scale.x, m_scale.y, m_scale.z };
+                const float p[3] = { m_position.x, m_position.y, m_position.z };
+                for (int i = 0; i < 3; ++i) {
+                    const float inv = s[i] != 0.f ? 1.f / s[i] : 0.f;
+                    float t = 0.f;
+                    for (int j = 0; j < 3; ++j) {
+                        m_inverse.m[i][j] = r.m[j][i] * inv;
+                        t -= m_inverse.m[i][j] * p[j];
+                    }
+                    m_inverse.m[i][3] = t;
+                    m_inverse.m[3][i] = 0.f;
+                }
+                m_inverse.m[3][3] = 1.f;
+                m_dirty &= ~INVERSE_DIRTY;
+            }
+            return m_inverse;
+        }
+
+        // TRS-form operations
+
+        CVector3
+            transformPoint(const CVector3& p) const {
+            return m_position + rotateVector(m_rotation, scaled(p, m_scale));
+        }
+
+        CVector3
+            transformVector(const CVector3& v) const {
+            return rotateVector(m_rotation, scaled(v, m_scale));
+        }
+
+        CVector3
+            inverseTransformPoint(const CVector3& p) const {
+            return unscaled(rotateVector(conjugate(m_rotation), p - m_position), m_scale);
+        }
+
+        /**
+         * @brief Composition parent * child (child applied first). Exact when the
+         *        parent scale is uniform; with non-uniform parent scale and a rotated
+         *        child the result would need shear, which TRS cannot hold.
+         */
+        Transform
+            operator*(const Transform& child) const {
+            Transform r;
+            r.m_position = transformPoint(child.m_position);
+            r.m_rotation = (m_rotation * child.m_rotation).normalized();
+            r.m_scale = scaled(m_scale, child.m_scale);
+            return r;
+        }
+
+        /**
+         * @brief Inverse transform in TRS form. Exact for uniform scale (see operator*).
+         */
+        Transform
+            inverse() const {
+            Transform r;
+            r.m_rotation = conjugate(m_rotation);
+            r.m_scale = CVector3(m_scale.x != 0.f ? 1.f / m_scale.x : 0.f,
+                                 m_scale.y != 0.f ? 1.f / m_scale.y : 0.f,
+                                 m_scale.z != 0.f ? 1.f / m_scale.z : 0.f);
+            r.m_position = scaled(rotateVector(r.m_rotation, m_position), r.m_scale) * -1.f;
+            return r;
+        }
+
+        static Transform
+            identity() {
+            return Transform();
+        }
+
+    private:
+        enum
+            DirtyFlags {
+            MATRIX_DIRTY = 1 << 0,
+            INVERSE_DIRTY = 1 << 1
+        };
+
+        /**
+         * @brief Rotates v by a unit quaternion: v + 2w(u x v) + 2u x (u x v).
+         */
+        static CVector3
+            rotateVector(const Quaternion& q, const CVector3& v) {
+            const CVector3 u(q.x, q.y, q.z);
+            const CVector3 t = u.cross(v) * 2.f;
+            return v + t * q.w + u.cross(t);
+        }
+
+        static Quaternion
+            conjugate(const Quaternion& q) {
+            return Quaternion(-q.x, -q.y, -q.z, q.w);
+        }
+
+        static CVector3
+            scaled(const CVector3& v, const CVector3& s) {
+            return CVector3(v.x * s.x, v.y * s.y, v.z * s.z);
+        }
+
+        static CVector3
+            unscaled(const CVector3& v, const CVector3& s) {
+            return CVector3(s.x != 0.f ? v.x / s.x : 0.f, s.y != 0.f ? v.y / s.y : 0.f, s.z != 0.f ? v.z / s.z : 0.f);
+        }
+
+        CVector3 m_position;
+        Quaternion m_rotation;
+        CVector3 m_scale;
+        mutable Matrix4x4 m_matrix;
+        mutable Matrix4x4 m_inverse;
+        mutable unsigned int m_dirty;
+    };
+
+} // namespace EU
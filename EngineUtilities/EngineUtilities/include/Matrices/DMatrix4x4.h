@@ -0,0 +1,220 @@
+#pragma once
+
+#include <Core/SIMD.h>
+#include <Vectors/DVector3.h>
+#include <Matrices/Matrix4x4.h>
+
+/**
+ * @file DMatrix4x4.h
+ * @brief Double-precision 4x4 matrix for world-space transforms in large worlds.
+ *
+ * Same conventions as Matrix4x4 (row-major, column vectors, translation in the last
+ * column). Rendering takes toCameraRelative(): the translation is rebased in double
+ * and everything is then rounded to a float Matrix4x4.
+ */
+
+namespace EU {
+
+    /**
+     * @class DMatrix4x4
+     * @brief 4x4 matrix of doubles.
+     */
+    class
+        DMatrix4x4 {
+    public:
+
+        /**
+         * @brief Matrix elements in row-major order.
+         */
+        double m[4][4];
+
+        /**
+         * @brief Default constructor. Initializes the matrix as identity.
+         */
+        DMatrix4x4() {
+            setIdentity();
+        }
+
+        /**
+         * @brief Constructs a matrix with 16 values.
+         * @param m00-m33 Values in row-major order.
+         */
+        DMatrix4x4(
+            double m00, double m01, double m02, double m03,
+            double m10, double m11, double m12, double m13,
+            double m20, double m21, double m22, double m23,
+            double m30, double m31, double m32, double m33) {
+            m[0][0] = m00; m[0][1] = m01; m[0][2] = m02; m[0][3] = m03;
+            m[1][0] = m10; m[1][1] = m11; m[1][2] = m12; m[1][3] = m13;
+            m[2][0] = m20; m[2][1] = m21; m[2][2] = m22; m[2][3] = m23;
+            m[3][0] = m30; m[3][1] = m31; m[3][2] = m32; m[3][3] = m33;
+        }
+
+        /**
+         * @brief Widens a float matrix.
+         */
+        explicit DMatrix4x4(const Matrix4x4& f) {
+            for (int i = 0; i < 4; ++i) {
+                for (int j = 0; j < 4; ++j) m[i][j] = f.m[i][j];
+            }
+        }
+
+        /**
+         * @brief Product, each output row accumulated in two double2 registers.
+         */
+        DMatrix4x4
+            operator*(const DMatrix4x4& o) const {
+            using SIMD::double2;
+            DMatrix4x4 r;
+            for (int i = 0; i < 4; ++i) {
+                double2 lo = double2::loadu(o.m[0]) * double2(m[i][0]);
+                double2 hi = double2::loadu(o.m[0] + 2) * double2(m[i][0]);
+                for (int k = 1; k < 4; ++k) {
+                    lo = lo + double2::loadu(o.m[k]) * double2(m[i][k]);
+                    hi = hi + double2::loadu(o.m[k] + 2) * double2(m[i][k]);
+                }
+                lo.storeu(r.m[i]);
+                hi.storeu(r.m[i] + 2);
+            }
+            return r;
+        }
+
+        /**
+         * @brief Transforms a point (w = 1, no projective divide).
+         */
+        DVector3
+            transformPoint(const DVector3& p) const {
+            return DVector3(m[0][0] * p.x + m[0][1] * p.y + m[0][2] * p.z + m[0][3],
+                            m[1][0] * p.x + m[1][1] * p.y + m[1][2] * p.z + m[1][3],
+                            m[2][0] * p.x + m[2][1] * p.y + m[2][2] * p.z + m[2][3]);
+        }
+
+        /**
+         * @brief Transforms a direction (translation ignored).
+         */
+        DVector3
+            transformVector(const DVector3& v) const {
+            return DVector3(m[0][0] * v.x + m[0][1] * v.y + m[0][2] * v.z,
+                            m[1][0] * v.x + m[1][1] * v.y + m[1][2] * v.z,
+                            m[2][0] * v.x + m[2][1] * v.y + m[2][2] * v.z);
+        }
+
+        DVector3
+            getTranslation() const {
+            return DVector3(m[0][3], m[1][3], m[2][3]);
+        }
+
+        void
+            setTranslation(const DVector3& t) {
+            m[0][3] = t.x;
+            m[1][3] = t.y;
+            m[2][3] = t.z;
+        }
+
+        /**
+         * @brief Inverse of an affine matrix (last row 0, 0, 0, 1): inverse of the 3x3
+         *        part and -inverse * translation.
+         * @return Identity if not invertible.
+         */
+        DMatrix4x4
+            inverseAffine() const {
+            const double c00 = m[1][1] * m[2][2] - m[1][2] * m[2][1];
+            const double c01 = m[1][2] * m[2][0] - m[1][0] * m[2][2];
+            const double c02 = m[1][0] * m[2][1] - m[1][1] * m[2][0];
+            const double det = m[0][0] * c00 + m[0][1] * c01 + m[0][2] * c02;
+            if (det == 0.0) return DMatrix4x4();
+            const double inv = 1.0 / det;
+            DMatrix4x4 r;
+            r.m[0][0] = c00 * inv;
+            r.m[0][1] = (m[0][2] * m[2][1] - m[0][1] * m[2][2]) * inv;
+            r.m[0][2] = (m[0][1] * m[1][2] - m[0][2] * m[1][1]) * inv;
+            r.m[1][0] = c01 * inv;
+            r.m[1][1] = (m[0][0] * m[2][2] - m[0][2] * m[2][0]) * inv;
+            r.m[1][2] = (m[0][2] * m[1][0] - m[0][0] * m[1][2]) * inv;
+            r.m[2][0] = c02 * inv;
+            r.m[2][1] = (m[0][1] * m[2][0] - m[0][0] * m[2][1]) * inv;
+            r.m[2][2] = (m[0][0] * m[1][1] - m[0][1] * m[1][0]) * inv;
+            r.setTranslation(-r.transformVector(getTranslation()));
+            return r;
+        }
+
+        /**
+         * @brief Float matrix of the same transform expressed relative to origin
+         *        (usually the camera position): translation - origin in double, then
+         *        every element rounded.
+         */
+        Matrix4x4
+            toCameraRelative(const DVector3& origin) const {
+            return Matrix4x4(
+                static_cast<float>(m[0][0]), static_cast<float>(m[0][1]), static_cast<float>(m[0][2]), static_cast<float>(m[0][3] - origin.x),
+                static_cast<float>(m[1][0]), static_cast<float>(m[1][1]), static_cast<float>(m[1][2]), static_cast<float>(m[1][3] - origin.y),
+                static_cast<float>(m[2][0]), static_cast<float>(m[2][1]), static_cast<float>(m[2][2]), static_cast<float>(m[2][3] - origin.z),
+                static_cast<float>(m[3][0]), static_cast<float>(m[3][1]), static_cast<float>(m[3][2]), static_cast<float>(m[3][3]));
+        }
+
+        DMatrix4x4
+            transpose() const {
+            return DMatrix4x4(
+                m[0][0], m[1][0], m[2][0], m[3][0],
+                m[0][1], m[1][1], m[2][1], m[3][1],
+                m[0][2], m[1][2], m[2][2], m[3][2],
+                m[0][3], m[1][3], m[2][3], m[3][3]
+            );
+        }
+
+        /**
+         * @brief Sets this matrix to the identity matrix.
+         */
+        void
+            setIdentity() {
+            for (int i = 0; i < 4; ++i) {
+                for (int j = 0; j < 4; ++j) m[i][j] = i == j ? 1.0 : 0.0;
+            }
+        }
+
+        static DMatrix4x4
+            identity() {
+            return DMatrix4x4();
+        }
+
+        static DMatrix4x4
+            translation(const DVector3& t) {
+            DMatrix4x4 r;
+            r.setTranslation(t);
+            return r;
+        }
+
+        /**
+         * @brief Float local transform (rotation, scale) placed at a double position.
+         */
+        static DMatrix4x4
+            fromLocal(const Matrix4x4& local, const DVector3& position) {
+            DMatrix4x4 r(local);
+            r.setTranslation(position + DVector3(local.m[0][3], local.m[1][3], local.m[2][3]));
+            return r;
+        }
+    };
+
+    namespace LargeWorld {
+
+        /**
+         * @brief toCameraRelative() for count matrices; rows are rebased and rounded
+         *        four elements at a time.
+         */
+        inline void
+            rebase(const DMatrix4x4* matrices, int count, const DVector3& origin, Matrix4x4* out) {
+            using SIMD::double2;
+            const double2 zero;
+            const double2 rowOffset[3] = { double2(0.0, origin.x), double2(0.0, origin.y), double2(0.0, origin.z) };
+            for (int i = 0; i < count; ++i) {
+                for (int r = 0; r < 4; ++r) {
+                    const double* row = matrices[i].m[r];
+                    const double2 hiOffset = r < 3 ? rowOffset[r] : zero;
+                    SIMD::toFloat(double2::loadu(row), double2::loadu(row + 2) - hiOffset).storeu(out[i].m[r]);
+                }
+            }
+        }
+
+    } // namespace LargeWorld
+
+} // namespace EU
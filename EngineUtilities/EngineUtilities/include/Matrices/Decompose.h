@@ -0,0 +1,294 @@
+#pragma once
+
+#include <Core/SIMD.h>
+#include <Vectors/Vector3.h>
+#include <Rotations/Quaternion.h>
+#include <Matrices/Matrix3x3.h>
+#include <Matrices/Matrix4x4.h>
+
+/**
+ * @file Decompose.h
+ * @brief Translation, rotation and scale of arbitrary affine matrices, through a
+ *        polar decomposition that also handles non-uniform scale and shear.
+ *
+ * The linear part A is split as A = R * S, R a rotation and S the stretch (symmetric
+ * for proper matrices). R comes from Higham's iteration R <- (g R + R^-T / g) / 2
+ * with Frobenius-norm scaling g, which converges quadratically and needs no
+ * eigen-solver. A mirrored A (det < 0) gives a negative scale.x. The same branch-free
+ * kernel runs on floats and, in decompose() for arrays, on four matrices per
+ * SIMD::float4.
+ */
+
+namespace EU {
+    namespace Decompose {
+
+        /**
+         * @struct TRS
+         * @brief Result of a decomposition: M = T(translation) * R(rotation) * stretch.
+         */
+        struct
+            TRS {
+            CVector3 translation;
+            Quaternion rotation;
+            CVector3 scale;         ///< Diagonal of stretch.
+            Matrix3x3 stretch;      ///< Off-diagonal terms are the shear (0 for a pure TRS matrix).
+        };
+
+        /**
+         * @brief Iterations of the polar kernel; enough for every matrix polar() accepts
+         *        (Frobenius condition number below 1e6) in float.
+         */
+        constexpr int POLAR_ITERATIONS = 10;
+
+        namespace detail {
+
+            inline float select(bool c, float a, float b) { return c ? a : b; }
+            inline float sqrt(float x) { return Math::sqrt(x); }
+            inline float abs(float x) { return x < 0.f ? -x : x; }
+            inline float max(float a, float b) { return a > b ? a : b; }
+
+            using SIMD::select;
+            using SIMD::sqrt;
+            using SIMD::abs;
+            using SIMD::max;
+
+            /**
+             * @brief 3x3 matrix of F = float or SIMD::float4 (four matrices, one per lane).
+             */
+            template<class F>
+            struct
+                Mat3 {
+                F m[3][3];
+            };
+
+            /**
+             * @brief Cofactor matrix of q (the transpose of its adjugate).
+             */
+            template<class F>
+            inline void
+                cofactors(const F (&q)[3][3], F (&c)[3][3]) {
+                c[0][0] = q[1][1] * q[2][2] - q[1][2] * q[2][1];
+                c[0][1] = q[1][2] * q[2][0] - q[1][0] * q[2][2];
+                c[0][2] = q[1][0] * q[2][1] - q[1][1] * q[2][0];
+                c[1][0] = q[0][2] * q[2][1] - q[0][1] * q[2][2];
+                c[1][1] = q[0][0] * q[2][2] - q[0][2] * q[2][0];
+                c[1][2] = q[0][1] * q[2][0] - q[0][0] * q[2][1];
+                c[2][0] = q[0][1] * q[1][2] - q[0][2] * q[1][1];
+                c[2][1] = q[0][2] * q[1][0] - q[0][0] * q[1][2];
+                c[2][2] = q[0][0] * q[1][1] - q[0][1] * q[1][0];
+            }
+
+            /**
+             * @brief A = R * S. Lanes whose A is (nearly) singular get R = identity and
+             *        S = A; the returned mask (bool or lane mask) marks the good ones.
+             */
+            template<class F, class Mask>
+            inline Mask
+                polar(const Mat3<F>& a, Mat3<F>& r, Mat3<F>& s) {
+                const F zero(0.f), one(1.f), half(0.5f);
+                r = a;
+                F ca[3][3];
+                cofactors(a.m, ca);
+                F norm = zero, normC = zero;
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = 0; j < 3; ++j) {
+                        norm = norm + a.m[i][j] * a.m[i][j];
+                        normC = normC + ca[i][j] * ca[i][j];
+                    }
+                }
+                const F detA = a.m[0][0] * ca[0][0] + a.m[0][1] * ca[0][1] + a.m[0][2] * ca[0][2];
+                // Condition number ||A|| ||A^-1|| = ||A|| ||adj A|| / |det| below 1e6 (Frobenius
+                // norms): independent of the overall scale, and only truly singular or
+                // degenerate maps fail, however non-uniform the scale is.
+                const Mask ok = abs(detA) > F(1e-6f) * sqrt(norm) * sqrt(normC);
+
+                for (int it = 0; it < POLAR_ITERATIONS; ++it) {
+                    const F (&q)[3][3] = r.m;
+                    F c[3][3];
+                    cofactors(q, c);
+                    const F det = q[0][0] * c[0][0] + q[0][1] * c[0][1] + q[0][2] * c[0][2];
+                    const F invDet = one / select(ok, det, one);
+
+                    // R^-T = cofactors / det; g = sqrt(||R^-1|| / ||R||).
+                    F nq = zero, nc = zero;
+                    for (int i = 0; i < 3; ++i) {
+                        for (int j = 0; j < 3; ++j) {
+                            nq = nq + q[i][j] * q[i][j];
+                            nc = nc + c[i][j] * c[i][j];
+                        }
+                    }
+                    const F g = sqrt(sqrt(nc * invDet * invDet / select(ok, nq, one)));
+                    const F wq = half * g, wc = half * invDet / select(ok, g, one);
+                    for (int i = 0; i < 3; ++i) {
+                        for (int j = 0; j < 3; ++j) r.m[i][j] = wq * q[i][j] + wc * c[i][j];
+                    }
+                }
+
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = 0; j < 3; ++j) r.m[i][j] = select(ok, r.m[i][j], i == j ? one : zero);
+                }
+                // A mirror keeps det(R) = -1: move it into the stretch as R * D, D * S.
+                const F flip = select(detA < zero, F(-1.f), one);
+                for (int i = 0; i < 3; ++i) r.m[i][0] = r.m[i][0] * flip;
+
+                // S = R^T A
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = 0; j < 3; ++j) {
+                        s.m[i][j] = r.m[0][i] * a.m[0][j] + r.m[1][i] * a.m[1][j] + r.m[2][i] * a.m[2][j];
+                    }
+                }
+                return ok;
+            }
+
+            /**
+             * @brief Rotation matrix to (x, y, z, w), Shepperd's method without branches:
+             *        the largest of 4w^2, 4x^2, 4y^2, 4z^2 (t) is picked by selects, and
+             *        every component is then numerator / (2 sqrt(t)). Returns w >= 0.
+             */
+            template<class F>
+            inline void
+                toQuaternion(const Mat3<F>& r, F& x, F& y, F& z, F& w) {
+                const F zero(0.f), one(1.f), half(0.5f);
+                const F (&m)[3][3] = r.m;
+                const F tw = one + m[0][0] + m[1][1] + m[2][2];
+                const F tx = one + m[0][0] - m[1][1] - m[2][2];
+                const F ty = one - m[0][0] + m[1][1] - m[2][2];
+                const F tz = one - m[0][0] - m[1][1] + m[2][2];
+                const F dx = m[2][1] - m[1][2], dy = m[0][2] - m[2][0], dz = m[1][0] - m[0][1];
+                const F sxy = m[0][1] + m[1][0], sxz = m[0][2] + m[2][0], syz = m[1][2] + m[2][1];
+
+                // Start from the z case and switch whenever a larger t shows up.
+                F t = tz, nw = dz, nx = sxz, ny = syz, nz = tz;
+                const auto pick = [&](const F& tc, const F& cw, const F& cx, const F& cy, const F& cz) {
+                    const auto larger = tc > t;
+                    t = select(larger, tc, t);
+                    nw = select(larger, cw, nw);
+                    nx = select(larger, cx, nx);
+                    ny = select(larger, cy, ny);
+                    nz = select(larger, cz, nz);
+                };
+                pick(ty, dy, sxy, ty, syz);
+                pick(tx, dx, tx, sxy, sxz);
+                pick(tw, tw, dx, dy, dz);
+
+                const F k = half / sqrt(t);
+                const F sign = select(nw < zero, F(-1.f), one);
+                x = nx * k * sign;
+                y = ny * k * sign;
+                z = nz * k * sign;
+                w = nw * k * sign;
+                const F inv = one / sqrt(x * x + y * y + z * z + w * w);
+                x = x * inv;
+                y = y * inv;
+                z = z * inv;
+                w = w * inv;
+            }
+
+            inline void
+                store(const Mat3<float>& r, const Mat3<float>& s, TRS& out) {
+                float x, y, z, w;
+                toQuaternion(r, x, y, z, w);
+                out.rotation = Quaternion(x, y, z, w);
+                out.stretch = Matrix3x3(s.m[0][0], s.m[0][1], s.m[0][2],
+                                        s.m[1][0], s.m[1][1], s.m[1][2],
+                                        s.m[2][0], s.m[2][1], s.m[2][2]);
+                out.scale = CVector3(s.m[0][0], s.m[1][1], s.m[2][2]);
+            }
+
+        } // namespace detail
+
+        /**
+         * @brief Polar decomposition a = rotation * stretch.
+         * @return False if a is singular (then rotation is identity and stretch = a).
+         */
+        inline bool
+            polar(const Matrix3x3& a, Matrix3x3& rotation, Matrix3x3& stretch) {
+            detail::Mat3<float> in, r, s;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) in.m[i][j] = a.m[i][j];
+            }
+            const bool ok = detail::polar<float, bool>(in, r, s);
+            rotation = Matrix3x3(r.m[0][0], r.m[0][1], r.m[0][2], r.m[1][0], r.m[1][1], r.m[1][2], r.m[2][0], r.m[2][1], r.m[2][2]);
+            stretch = Matrix3x3(s.m[0][0], s.m[0][1], s.m[0][2], s.m[1][0], s.m[1][1], s.m[1][2], s.m[2][0], s.m[2][1], s.m[2][2]);
+            return ok;
+        }
+
+        /**
+         * @brief Decomposes a 3D linear map (translation is zero).
+         * @return False if m is singular.
+         */
+        inline bool
+            decompose(const Matrix3x3& m, TRS& out) {
+            detail::Mat3<float> in, r, s;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) in.m[i][j] = m.m[i][j];
+            }
+            const bool ok = detail::polar<float, bool>(in, r, s);
+            out.translation = CVector3(0.f, 0.f, 0.f);
+            detail::store(r, s, out);
+            return ok;
+        }
+
+        /**
+         * @brief Decomposes an affine matrix; the projective row is ignored.
+         * @return False if the 3x3 part is singular.
+         */
+        inline bool
+            decompose(const Matrix4x4& m, TRS& out) {
+            detail::Mat3<float> in, r, s;
+            for (int i = 0; i < 3; ++i) {
+                for (int j = 0; j < 3; ++j) in.m[i][j] = m.m[i][j];
+            }
+            const bool ok = detail::polar<float, bool>(in, r, s);
+            out.translation = CVector3(m.m[0][3], m.m[1][3], m.m[2][3]);
+            detail::store(r, s, out);
+            return ok;
+        }
+
+        /**
+         * @brief Decomposes count matrices, four per SIMD pass.
+         * @return Number of singular matrices (decomposed with identity rotation).
+         */
+        inline int
+            decompose(const Matrix4x4* matrices, int count, TRS* out) {
+            using SIMD::float4;
+            static const Matrix4x4 identity;
+            int failed = 0;
+            for (int base = 0; base < count; base += SIMD::LANES) {
+                const int lanes = count - base < SIMD::LANES ? count - base : SIMD::LANES;
+                const Matrix4x4* src[SIMD::LANES];
+                for (int k = 0; k < SIMD::LANES; ++k) src[k] = k < lanes ? &matrices[base + k] : &identity;
+
+                detail::Mat3<float4> a, r, s;
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = 0; j < 3; ++j) {
+                        a.m[i][j] = float4(src[0]->m[i][j], src[1]->m[i][j], src[2]->m[i][j], src[3]->m[i][j]);
+                    }
+                }
+                const float4 ok = detail::polar<float4, float4>(a, r, s);
+                float4 qx, qy, qz, qw;
+                detail::toQuaternion(r, qx, qy, qz, qw);
+
+                alignas(16) float x[4], y[4], z[4], w[4], st[3][3][4];
+                qx.store(x); qy.store(y); qz.store(z); qw.store(w);
+                for (int i = 0; i < 3; ++i) {
+                    for (int j = 0; j < 3; ++j) s.m[i][j].store(st[i][j]);
+                }
+                const int good = SIMD::movemask(ok);
+                for (int k = 0; k < lanes; ++k) {
+                    TRS& o = out[base + k];
+                    const Matrix4x4& m = *src[k];
+                    o.translation = CVector3(m.m[0][3], m.m[1][3], m.m[2][3]);
+                    o.rotation = Quaternion(x[k], y[k], z[k], w[k]);
+                    o.stretch = Matrix3x3(st[0][0][k], st[0][1][k], st[0][2][k],
+                                          st[1][0][k], st[1][1][k], st[1][2][k],
+                                          st[2][0][k], st[2][1][k], st[2][2][k]);
+                    o.scale = CVector3(st[0][0][k], st[1][1][k], st[2][2][k]);
+                    if (!((good >> k) & 1)) ++failed;
+                }
+            }
+            return failed;
+        }
+
+    } // namespace Decompose
+} // namespace EU
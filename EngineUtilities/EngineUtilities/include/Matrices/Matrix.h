@@ -0,0 +1,295 @@
+#pragma once
+
+#include <Vectors/Vector.h>
+#include <Matrices/Matrix2x2.h>
+#include <Matrices/Matrix3x3.h>
+#include <Matrices/Matrix4x4.h>
+
+/**
+ * @file Matrix.h
+ * @brief Generic R x C matrix for float, double and int, stored row-major like
+ *        Matrix3x3 and Matrix4x4 and applied to column vectors.
+ *
+ * Products are unrolled at compile time. Matrix<float, R, 4> and Matrix<double, R, 4>
+ * products combine whole rows in SIMD::float4 / double2 registers. Matrix2x2,
+ * Matrix3x3 and Matrix4x4 stay the float types used across the library; toMatrix
+ * and the to* functions below convert.
+ */
+
+namespace EU {
+
+    template<class T, int R, int C>
+    class Matrix;
+
+    namespace detail {
+
+        /**
+         * @brief Product of an R x K and a K x C matrix, one output row at a time:
+         *        row_i(a * b) = sum_k a[i][k] * row_k(b).
+         */
+        template<class T, int R, int K, int C>
+        struct
+            MatrixProduct {
+            static void
+                apply(const T (&a)[R][K], const T (&b)[K][C], T (&r)[R][C]) {
+                Unroll<0, R>::apply([&](int i) {
+                    Unroll<0, C>::apply([&](int j) {
+                        T sum = T(0);
+                        Unroll<0, K>::apply([&](int k) { sum += a[i][k] * b[k][j]; });
+                        r[i][j] = sum;
+                    });
+                });
+            }
+        };
+
+        template<int R, int K>
+        struct
+            MatrixProduct<float, R, K, 4> {
+            static void
+                apply(const float (&a)[R][K], const float (&b)[K][4], float (&r)[R][4]) {
+                using SIMD::float4;
+                float4 rows[K];
+                Unroll<0, K>::apply([&](int k) { rows[k] = float4::loadu(b[k]); });
+                Unroll<0, R>::apply([&](int i) {
+                    float4 sum = rows[0] * float4(a[i][0]);
+                    Unroll<1, K>::apply([&](int k) { sum = SIMD::madd(rows[k], float4(a[i][k]), sum); });
+                    sum.storeu(r[i]);
+                });
+            }
+        };
+
+        template<int R, int K>
+        struct
+            MatrixProduct<double, R, K, 4> {
+            static void
+                apply(const double (&a)[R][K], const double (&b)[K][4], double (&r)[R][4]) {
+                using SIMD::double2;
+                Unroll<0, R>::apply([&](int i) {
+                    double2 lo = double2::loadu(b[0]) * double2(a[i][0]);
+                    double2 hi = double2::loadu(b[0] + 2) * double2(a[i][0]);
+                    Unroll<1, K>::apply([&](int k) {
+                        lo = lo + double2::loadu(b[k]) * double2(a[i][k]);
+                        hi = hi + double2::loadu(b[k] + 2) * double2(a[i][k]);
+                    });
+                    lo.storeu(r[i]);
+                    hi.storeu(r[i] + 2);
+                });
+            }
+        };
+
+    } // namespace detail
+
+    /**
+     * @class Matrix
+     * @brief R rows and C columns of type T.
+     */
+    template<class T, int R, int C>
+    class
+        Matrix {
+    public:
+        static_assert(R > 0 && C > 0, "Matrix needs at least one row and column");
+
+        /**
+         * @brief Matrix elements in row-major order.
+         */
+        T m[R][C];
+
+        /**
+         * @brief Default constructor. Ones on the diagonal, zeros elsewhere (identity
+         *        for square matrices), like Matrix2x2 and Matrix3x3.
+         */
+        Matrix() {
+            detail::Unroll<0, R>::apply([&](int i) {
+                detail::Unroll<0, C>::apply([&](int j) { m[i][j] = i == j ? T(1) : T(0); });
+            });
+        }
+
+        /**
+         * @brief R * C values in row-major order.
+         */
+        template<class... Rest>
+        Matrix(T first, T second, Rest... rest) {
+            static_assert(sizeof...(Rest) + 2 == R * C, "Matrix needs one value per element");
+            const T values[R * C] = { first, second, static_cast<T>(rest)... };
+            detail::Unroll<0, R * C>::apply([&](int i) { m[i / C][i % C] = values[i]; });
+        }
+
+        /**
+         * @brief Converts each element with static_cast.
+         */
+        template<class U>
+        explicit Matrix(const Matrix<U, R, C>& o) {
+            detail::Unroll<0, R * C>::apply([&](int i) { m[i / C][i % C] = static_cast<T>(o.m[i / C][i % C]); });
+        }
+
+        T&
+            operator()(int row, int col) { return m[row][col]; }
+
+        const T&
+            operator()(int row, int col) const { return m[row][col]; }
+
+        Vector<T, C>
+            row(int i) const {
+            Vector<T, C> r;
+            detail::Unroll<0, C>::apply([&](int j) { r[j] = m[i][j]; });
+            return r;
+        }
+
+        Vector<T, R>
+            column(int j) const {
+            Vector<T, R> c;
+            detail::Unroll<0, R>::apply([&](int i) { c[i] = m[i][j]; });
+            return c;
+        }
+
+        Matrix
+            operator+(const Matrix& o) const {
+            Matrix r;
+            detail::Unroll<0, R * C>::apply([&](int i) { r.m[i / C][i % C] = m[i / C][i % C] + o.m[i / C][i % C]; });
+            return r;
+        }
+
+        Matrix
+            operator-(const Matrix& o) const {
+            Matrix r;
+            detail::Unroll<0, R * C>::apply([&](int i) { r.m[i / C][i % C] = m[i / C][i % C] - o.m[i / C][i % C]; });
+            return r;
+        }
+
+        Matrix
+            operator*(T s) const {
+            Matrix r;
+            detail::Unroll<0, R * C>::apply([&](int i) { r.m[i / C][i % C] = m[i / C][i % C] * s; });
+            return r;
+        }
+
+        template<int K>
+        Matrix<T, R, K>
+            operator*(const Matrix<T, C, K>& o) const {
+            Matrix<T, R, K> r;
+            detail::MatrixProduct<T, R, C, K>::apply(m, o.m, r.m);
+            return r;
+        }
+
+        Vector<T, R>
+            operator*(const Vector<T, C>& v) const {
+            Vector<T, R> r;
+            detail::Unroll<0, R>::apply([&](int i) {
+                T sum = T(0);
+                detail::Unroll<0, C>::apply([&](int j) { sum += m[i][j] * v[j]; });
+                r[i] = sum;
+            });
+            return r;
+        }
+
+        Matrix<T, C, R>
+            transpose() const {
+            Matrix<T, C, R> t;
+            detail::Unroll<0, R * C>::apply([&](int i) { t.m[i % C][i / C] = m[i / C][i % C]; });
+            return t;
+        }
+
+        static Matrix
+            identity() { return Matrix(); }
+
+        static Matrix
+            zero() { return Matrix() * T(0); }
+    };
+
+    template<class T>
+    inline T
+        determinant(const Matrix<T, 2, 2>& a) {
+        return a.m[0][0] * a.m[1][1] - a.m[0][1] * a.m[1][0];
+    }
+
+    template<class T>
+    inline T
+        determinant(const Matrix<T, 3, 3>& a) {
+        return a.m[0][0] * (a.m[1][1] * a.m[2][2] - a.m[1][2] * a.m[2][1]) -
+               a.m[0][1] * (a.m[1][0] * a.m[2][2] - a.m[1][2] * a.m[2][0]) +
+               a.m[0][2] * (a.m[1][0] * a.m[2][1] - a.m[1][1] * a.m[2][0]);
+    }
+
+    /**
+     * @brief Inverse of a 2x2 or 3x3 float/double matrix.
+     * @return Identity if not invertible, like Matrix3x3::inverse().
+     */
+    template<class T>
+    inline Matrix<T, 2, 2>
+        inverse(const Matrix<T, 2, 2>& a) {
+        const T det = determinant(a);
+        if (det == T(0)) return Matrix<T, 2, 2>();
+        const T inv = T(1) / det;
+        return Matrix<T, 2, 2>(a.m[1][1] * inv, -a.m[0][1] * inv,
+                               -a.m[1][0] * inv, a.m[0][0] * inv);
+    }
+
+    template<class T>
+    inline Matrix<T, 3, 3>
+        inverse(const Matrix<T, 3, 3>& a) {
+        const T det = determinant(a);
+        if (det == T(0)) return Matrix<T, 3, 3>();
+        const T inv = T(1) / det;
+        Matrix<T, 3, 3> r;
+        for (int i = 0; i < 3; ++i) {
+            for (int j = 0; j < 3; ++j) {
+                // Adjugate: cofactor of element (j, i).
+                const int r1 = (j + 1) % 3, r2 = (j + 2) % 3;
+                const int c1 = (i + 1) % 3, c2 = (i + 2) % 3;
+                r.m[i][j] = (a.m[r1][c1] * a.m[r2][c2] - a.m[r1][c2] * a.m[r2][c1]) * inv;
+            }
+        }
+        return r;
+    }
+
+    typedef Matrix<float, 2, 2> Matrix2f;
+    typedef Matrix<float, 3, 3> Matrix3f;
+    typedef Matrix<float, 4, 4> Matrix4f;
+    typedef Matrix<double, 2, 2> Matrix2d;
+    typedef Matrix<double, 3, 3> Matrix3d;
+    typedef Matrix<double, 4, 4> Matrix4d;
+    typedef Matrix<int, 2, 2> Matrix2i;
+    typedef Matrix<int, 3, 3> Matrix3i;
+
+    // Conversions with the float classes
+
+    inline Matrix2f
+        toMatrix(const Matrix2x2& a) {
+        return Matrix2f(a.m00, a.m01, a.m10, a.m11);
+    }
+
+    inline Matrix3f
+        toMatrix(const Matrix3x3& a) {
+        Matrix3f r;
+        detail::Unroll<0, 9>::apply([&](int i) { r.m[i / 3][i % 3] = a.m[i / 3][i % 3]; });
+        return r;
+    }
+
+    inline Matrix4f
+        toMatrix(const Matrix4x4& a) {
+        Matrix4f r;
+        detail::Unroll<0, 16>::apply([&](int i) { r.m[i / 4][i % 4] = a.m[i / 4][i % 4]; });
+        return r;
+    }
+
+    inline Matrix2x2
+        toMatrix2x2(const Matrix2f& a) {
+        return Matrix2x2(a.m[0][0], a.m[0][1], a.m[1][0], a.m[1][1]);
+    }
+
+    inline Matrix3x3
+        toMatrix3x3(const Matrix3f& a) {
+        return Matrix3x3(a.m[0][0], a.m[0][1], a.m[0][2],
+                         a.m[1][0], a.m[1][1], a.m[1][2],
+                         a.m[2][0], a.m[2][1], a.m[2][2]);
+    }
+
+    /**
+     * @brief Copies into an existing Matrix4x4.
+     */
+    inline void
+        toMatrix4x4(const Matrix4f& a, Matrix4x4& out) {
+        detail::Unroll<0, 16>::apply([&](int i) { out.m[i / 4][i % 4] = a.m[i / 4][i % 4]; });
+    }
+
+} // namespace EU
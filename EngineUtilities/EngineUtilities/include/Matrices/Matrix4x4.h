@@ -4,6 +4,7 @@
 #include <Vectors/Vector3.h>
 #include <Vectors/Vector4.h>
 #include <Math/EngineMath.h>
+#include <Core/SIMD.h>
 
 /**
  * @file Matrix4x4.h
@@ -184,4 +185,176 @@ namespace EU {
             Matrix4x4 zero();
     };
 
-} // namespace EU
\ No newline at end of file
+    // Definitions
+
+    inline
+        Matrix4x4::Matrix4x4() {
+        setIdentity();
+    }
+
+    inline
+        Matrix4x4::Matrix4x4(
+            float m00, float m01, float m02, float m03,
+            float m10, float m11, float m12, float m13,
+            float m20, float m21, float m22, float m23,
+            float m30, float m31, float m32, float m33) {
+        m[0][0] = m00; m[0][1] = m01; m[0][2] = m02; m[0][3] = m03;
+        m[1][0] = m10; m[1][1] = m11; m[1][2] = m12; m[1][3] = m13;
+        m[2][0] = m20; m[2][1] = m21; m[2][2] = m22; m[2][3] = m23;
+        m[3][0] = m30; m[3][1] = m31; m[3][2] = m32; m[3][3] = m33;
+    }
+
+    inline Matrix4x4
+        Matrix4x4::operator+(const Matrix4x4& other) const {
+        Matrix4x4 r(*this);
+        return r += other;
+    }
+
+    inline Matrix4x4
+        Matrix4x4::operator-(const Matrix4x4& other) const {
+        Matrix4x4 r(*this);
+        return r -= other;
+    }
+
+    inline Matrix4x4
+        Matrix4x4::operator*(float scalar) const {
+        Matrix4x4 r(*this);
+        return r *= scalar;
+    }
+
+    /**
+     * Row i of the product is sum_k m[i][k] * row k of other, one float4 per row.
+     */
+    inline Matrix4x4
+        Matrix4x4::operator*(const Matrix4x4& other) const {
+        using SIMD::float4;
+        const float4 b0 = float4::loadu(other.m[0]), b1 = float4::loadu(other.m[1]);
+        const float4 b2 = float4::loadu(other.m[2]), b3 = float4::loadu(other.m[3]);
+        Matrix4x4 r;
+        for (int i = 0; i < 4; ++i) {
+            const float4 row = SIMD::madd(b0, float4(m[i][0]), SIMD::madd(b1, float4(m[i][1]),
+                               SIMD::madd(b2, float4(m[i][2]), b3 * float4(m[i][3]))));
+            row.storeu(r.m[i]);
+        }
+        return r;
+    }
+
+    inline CVector4
+        Matrix4x4::operator*(const CVector4& vec) const {
+        return CVector4(
+            m[0][0] * vec.x + m[0][1] * vec.y + m[0][2] * vec.z + m[0][3] * vec.w,
+            m[1][0] * vec.x + m[1][1] * vec.y + m[1][2] * vec.z + m[1][3] * vec.w,
+            m[2][0] * vec.x + m[2][1] * vec.y + m[2][2] * vec.z + m[2][3] * vec.w,
+            m[3][0] * vec.x + m[3][1] * vec.y + m[3][2] * vec.z + m[3][3] * vec.w
+        );
+    }
+
+    inline CVector3
+        Matrix4x4::transformPoint(const CVector3& vec) const {
+        float x = m[0][0] * vec.x + m[0][1] * vec.y + m[0][2] * vec.z + m[0][3];
+        float y = m[1][0] * vec.x + m[1][1] * vec.y + m[1][2] * vec.z + m[1][3];
+        float z = m[2][0] * vec.x + m[2][1] * vec.y + m[2][2] * vec.z + m[2][3];
+        float w = m[3][0] * vec.x + m[3][1] * vec.y + m[3][2] * vec.z + m[3][3];
+
+        if (w != 0.0f && w != 1.0f) {
+            x /= w;
+            y /= w;
+            z /= w;
+        }
+
+        return CVector3(x, y, z);
+    }
+
+    inline Matrix4x4&
+        Matrix4x4::operator+=(const Matrix4x4& other) {
+        for (int i = 0; i < 4; ++i) {
+            (SIMD::float4::loadu(m[i]) + SIMD::float4::loadu(other.m[i])).storeu(m[i]);
+        }
+        return *this;
+    }
+
+    inline Matrix4x4&
+        Matrix4x4::operator-=(const Matrix4x4& other) {
+        for (int i = 0; i < 4; ++i) {
+            (SIMD::float4::loadu(m[i]) - SIMD::float4::loadu(other.m[i])).storeu(m[i]);
+        }
+        return *this;
+    }
+
+    inline Matrix4x4&
+        Matrix4x4::operator*=(float scalar) {
+        for (int i = 0; i < 4; ++i) {
+            (SIMD::float4::loadu(m[i]) * SIMD::float4(scalar)).storeu(m[i]);
+        }
+        return *this;
+    }
+
+    inline float&
+        Matrix4x4::operator()(int row, int col) {
+        return m[row][col];
+    }
+
+    inline const float&
+        Matrix4x4::operator()(int row, int col) const {
+        return m[row][col];
+    }
+
+    inline Matrix4x4
+        Matrix4x4::transpose() const {
+        return Matrix4x4(
+            m[0][0], m[1][0], m[2][0], m[3][0],
+            m[0][1], m[1][1], m[2][1], m[3][1],
+            m[0][2], m[1][2], m[2][2], m[3][2],
+            m[0][3], m[1][3], m[2][3], m[3][3]
+        );
+    }
+
+    inline void
+        Matrix4x4::setIdentity() {
+        for (int i = 0; i < 4; ++i) {
+            for (int j = 0; j < 4; ++j) {
+                m[i][j] = i == j ? 1.f : 0.f;
+            }
+        }
+    }
+
+    inline void
+        Matrix4x4::setScale(float scaleX, float scaleY, float scaleZ) {
+        setIdentity();
+        m[0][0] = scaleX;
+        m[1][1] = scaleY;
+        m[2][2] = scaleZ;
+    }
+
+    inline void
+        Matrix4x4::setTranslation(float tx, float ty, float tz) {
+        setIdentity();
+        m[0][3] = tx;
+        m[1][3] = ty;
+        m[2][3] = tz;
+    }
+
+    inline void
+        Matrix4x4::setRotation(float radians) {
+        setIdentity();
+        const float c = Math::cos(radians);
+        const float s = Math::sin(radians);
+        m[0][0] = c;  m[0][1] = -s;
+        m[1][0] = s;  m[1][1] = c;
+    }
+
+    inline Matrix4x4
+        Matrix4x4::identity() {
+        return Matrix4x4();
+    }
+
+    inline Matrix4x4
+        Matrix4x4::zero() {
+        Matrix4x4 r;
+        for (int i = 0; i < 4; ++i) {
+            SIMD::float4::zero().storeu(r.m[i]);
+        }
+        return r;
+    }
+
+} // namespace EU
@@ -0,0 +1,296 @@
+#pragma once
+
+#include <vector>
+#include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @file FrameArena.h
+ * @brief Linear (bump) allocator for per-frame temporaries, with checkpoints and an
+ *        arena-backed span type for batch kernels to write into.
+ */
+
+namespace EU {
+
+    /**
+     * @class ArenaSpan
+     * @brief Fixed-capacity array living in a FrameArena. It never owns or frees its
+     *        memory: it is valid until the arena is rewound past it or reset.
+     *
+     * The size can grow up to the capacity with push_back()/resize(), which covers
+     * outputs whose final length is only known after the kernel ran (culled index
+     * lists, contact buffers).
+     */
+    template<class T>
+    class
+        ArenaSpan {
+    public:
+        ArenaSpan() : m_data(nullptr), m_size(0), m_capacity(0) {}
+
+        ArenaSpan(T* data, int size, int capacity) : m_data(data), m_size(size), m_capacity(capacity) {}
+
+        T*
+            data() { return m_data; }
+
+        const T*
+            data() const { return m_data; }
+
+        int
+            size() const { return m_size; }
+
+        int
+            capacity() const { return m_capacity; }
+
+        bool
+            empty() const { return m_size == 0; }
+
+        T&
+            operator[](int i) { return m_data[i]; }
+
+        const T&
+            operator[](int i) const { return m_data[i]; }
+
+        T*
+            begin() { return m_data; }
+
+        T*
+            end() { return m_data + m_size; }
+
+        const T*
+            begin() const { return m_data; }
+
+        const T*
+            end() const { return m_data + m_size; }
+
+        /**
+         * @brief Appends a value.
+         * @return False if the span is full (the value is dropped).
+         */
+        bool
+            push_back(const T& value) {
+            if (m_size >= m_capacity) return false;
+            m_data[m_size++] = value;
+            return true;
+        }
+
+        /**
+         * @brief Changes the size, clamped to [0, capacity()]. New elements are not initialized.
+         */
+        void
+            resize(int size) {
+            m_size = size < 0 ? 0 : (size > m_capacity ? m_capacity : size);
+        }
+
+        void
+            clear() { m_size = 0; }
+
+    private:
+        T* m_data;
+        int m_size;
+        int m_capacity;
+    };
+
+    /**
+     * @class FrameArena
+     * @brief Bump allocator made of one or more memory blocks.
+     *
+     * Allocation is a pointer increment; nothing is freed individually. Call reset()
+     * once per frame, or use ArenaScope / mark() + rewind() to release everything
+     * allocated after a checkpoint. If a frame needs more than the current blocks
+     * hold, a new block is appended and kept for the following frames, so after the
+     * first few frames the arena stops touching the heap.
+     *
+     * Only trivially destructible types may be placed in the arena, since no
+     * destructor ever runs.
+     */
+    class
+        FrameArena {
+    public:
+        static constexpr std::size_t DEFAULT_ALIGNMENT = 16;   ///< Enough for SIMD::float4 loads.
+
+        /**
+         * @brief Position in the arena, used to rewind.
+         */
+        struct
+            Marker {
+            std::size_t block;
+            std::size_t offset;
+        };
+
+        /**
+         * @brief Creates an arena.
+         * @param blockSize Size in bytes of the first block and of any block added later.
+         */
+        explicit FrameArena(std::size_t blockSize = 1 << 20)
+            : m_blockSize(blockSize), m_block(0), m_offset(0), m_peak(0) {
+            addBlock(blockSize);
+        }
+
+        FrameArena(const FrameArena&) = delete;
+        FrameArena& operator=(const FrameArena&) = delete;
+
+        /**
+         * @brief Allocates raw memory.
+         * @param bytes Number of bytes.
+         * @param alignment Power-of-two alignment.
+         * @return Pointer to uninitialized memory; never null.
+         */
+        void*
+            allocate(std::size_t bytes, std::size_t alignment = DEFAULT_ALIGNMENT) {
+            for (;;) {
+                Block& b = m_blocks[m_block];
+                const std::uintptr_t base = reinterpret_cast<std::uintptr_t>(b.memory.get());
+                const std::uintptr_t p = (base + m_offset + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1);
+                const std::size_t end = static_cast<std::size_t>(p - base) + bytes;
+                if (end <= b.size) {
+                    m_offset = end;
+                    trackPeak();
+                    return reinterpret_cast<void*>(p);
+                }
+                // Move on to the next block, creating one large enough if needed.
+                if (m_block + 1 == m_blocks.size()) {
+                    addBlock(bytes + alignment > m_blockSize ? bytes + alignment : m_blockSize);
+                }
+                else if (m_blocks[m_block + 1].size < bytes + alignment) {
+                    m_blocks.insert(m_blocks.begin() + static_cast<std::ptrdiff_t>(m_block) + 1, makeBlock(bytes + alignment));
+                }
+                ++m_block;
+                m_offset = 0;
+            }
+        }
+
+        /**
+         * @brief Allocates an uninitialized array of count objects.
+         */
+        template<class T>
+        T*
+            allocateArray(int count, std::size_t alignment = alignof(T) > DEFAULT_ALIGNMENT ? alignof(T) : DEFAULT_ALIGNMENT) {
+            static_assert(std::is_trivially_destructible<T>::value, "FrameArena never runs destructors");
+            return static_cast<T*>(allocate(sizeof(T) * static_cast<std::size_t>(count > 0 ? count : 0), alignment));
+        }
+
+        /**
+         * @brief Allocates a span whose size equals its capacity (e.g. transformed vertices).
+         */
+        template<class T>
+        ArenaSpan<T>
+            allocateSpan(int count) {
+            return ArenaSpan<T>(allocateArray<T>(count), count, count);
+        }
+
+        /**
+         * @brief Allocates an empty span with room for capacity elements (e.g. culled indices).
+         */
+        template<class T>
+        ArenaSpan<T>
+            reserveSpan(int capacity) {
+            return ArenaSpan<T>(allocateArray<T>(capacity), 0, capacity);
+        }
+
+        /**
+         * @brief Current position; pass it to rewind() to free what comes after.
+         */
+        Marker
+            mark() const {
+            Marker m;
+            m.block = m_block;
+            m.offset = m_offset;
+            return m;
+        }
+
+        /**
+         * @brief Releases every allocation made after the marker.
+         */
+        void
+            rewind(const Marker& marker) {
+            m_block = marker.block;
+            m_offset = marker.offset;
+        }
+
+        /**
+         * @brief Releases everything; blocks are kept for the next frame.
+         */
+        void
+            reset() {
+            m_block = 0;
+            m_offset = 0;
+        }
+
+        /**
+         * @brief Total bytes reserved by all blocks.
+         */
+        std::size_t
+            capacity() const {
+            std::size_t total = 0;
+            for (const Block& b : m_blocks) total += b.size;
+            return total;
+        }
+
+        /**
+         * @brief Highest number of bytes in use since construction (including padding and
+         *        the unused tail of skipped blocks). Useful to size the first block.
+         */
+        std::size_t
+            peakUsage() const {
+            return m_peak;
+        }
+
+    private:
+        struct
+            Block {
+            std::unique_ptr<unsigned char[]> memory;
+            std::size_t size;
+        };
+
+        static Block
+            makeBlock(std::size_t size) {
+            Block b;
+            b.memory.reset(new unsigned char[size]);
+            b.size = size;
+            return b;
+        }
+
+        void
+            addBlock(std::size_t size) {
+            m_blocks.push_back(makeBlock(size));
+        }
+
+        void
+            trackPeak() {
+            std::size_t used = m_offset;
+            for (std::size_t i = 0; i < m_block; ++i) used += m_blocks[i].size;
+            if (used > m_peak) m_peak = used;
+        }
+
+        std::vector<Block> m_blocks;
+        std::size_t m_blockSize;
+        std::size_t m_block;
+        std::size_t m_offset;
+        std::size_t m_peak;
+    };
+
+    /**
+     * @class ArenaScope
+     * @brief Marks the arena on construction and rewinds it on destruction, so
+     *        temporaries of a pipeline stage are released when the stage returns.
+     */
+    class
+        ArenaScope {
+    public:
+        explicit ArenaScope(FrameArena& arena) : m_arena(arena), m_marker(arena.mark()) {}
+
+        ~ArenaScope() {
+            m_arena.rewind(m_marker);
+        }
+
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
+
+    private:
+        FrameArena& m_arena;
+        FrameArena::Marker m_marker;
+    };
+
+} // namespace EU
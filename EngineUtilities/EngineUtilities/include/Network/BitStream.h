@@ -0,0 +1,211 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+/**
+ * @file BitStream.h
+ * @brief Bit-level writer and reader for compact network messages.
+ *
+ * Values are packed LSB first into a 64-bit scratch word that is flushed to the
+ * sink four bytes at a time, in a fixed little-endian byte order, so the stream
+ * decodes the same on every platform.
+ */
+
+namespace EU {
+
+    /**
+     * @struct ByteSink
+     * @brief Minimal BitWriter sink appending to a byte vector. sf::Packet can be
+     *        used as a sink directly (see Network/PacketBits.h).
+     */
+    struct
+        ByteSink {
+        std::vector<std::uint8_t>& bytes;
+
+        explicit ByteSink(std::vector<std::uint8_t>& target) : bytes(target) {}
+
+        void
+            append(const void* data, std::size_t size) {
+            const std::uint8_t* p = static_cast<const std::uint8_t*>(data);
+            bytes.insert(bytes.end(), p, p + size);
+        }
+    };
+
+    /**
+     * @class BitWriter
+     * @brief Writes bit fields into any Sink with append(const void*, std::size_t).
+     *
+     * Call flush() (or let the writer go out of scope) once the message is complete;
+     * the last byte is zero-padded.
+     */
+    template<class Sink>
+    class
+        BitWriter {
+    public:
+        explicit BitWriter(Sink& sink) : m_sink(&sink), m_scratch(0), m_scratchBits(0), m_bitCount(0) {}
+
+        ~BitWriter() {
+            flush();
+        }
+
+        BitWriter(const BitWriter&) = delete;
+        BitWriter& operator=(const BitWriter&) = delete;
+
+        /**
+         * @brief Writes the low bits of value.
+         * @param bits Field width, 1 to 32.
+         */
+        void
+            write(std::uint32_t value, int bits) {
+            if (bits < 32) value &= (1u << bits) - 1u;
+            m_scratch |= static_cast<std::uint64_t>(value) << m_scratchBits;
+            m_scratchBits += bits;
+            m_bitCount += static_cast<std::size_t>(bits);
+            if (m_scratchBits >= 32) {
+                emit(4);
+                m_scratch >>= 32;
+                m_scratchBits -= 32;
+            }
+        }
+
+        void
+            writeBool(bool value) {
+            write(value ? 1u : 0u, 1);
+        }
+
+        /**
+         * @brief Writes a float losslessly (32 bits).
+         */
+        void
+            writeFloat(float value) {
+            std::uint32_t u;
+            std::memcpy(&u, &value, sizeof(u));
+            write(u, 32);
+        }
+
+        /**
+         * @brief Bits written so far, including those not yet flushed.
+         */
+        std::size_t
+            bitCount() const {
+            return m_bitCount;
+        }
+
+        /**
+         * @brief Writes the pending partial word. Further writes start a new byte.
+         */
+        void
+            flush() {
+            if (m_scratchBits == 0) return;
+            emit((m_scratchBits + 7) / 8);
+            m_scratch = 0;
+            m_bitCount += static_cast<std::size_t>((8 - m_scratchBits % 8) % 8);
+            m_scratchBits = 0;
+        }
+
+    private:
+        void
+            emit(int byteCount) {
+            std::uint8_t bytes[4];
+            for (int i = 0; i < byteCount; ++i) bytes[i] = static_cast<std::uint8_t>(m_scratch >> (8 * i));
+            m_sink->append(bytes, static_cast<std::size_t>(byteCount));
+        }
+
+        Sink* m_sink;
+        std::uint64_t m_scratch;
+        int m_scratchBits;
+        std::size_t m_bitCount;
+    };
+
+    /**
+     * @class BitReader
+     * @brief Reads bit fields written by BitWriter from a byte range.
+     *
+     * Reading past the end returns zeros and sets overflowed(), so a truncated or
+     * malicious message can be rejected after decoding instead of checked per field.
+     */
+    class
+        BitReader {
+    public:
+        BitReader(const void* data, std::size_t size)
+            : m_data(static_cast<const std::uint8_t*>(data)), m_size(size), m_next(0),
+              m_scratch(0), m_scratchBits(0), m_bitsRead(0), m_overflowed(false) {}
+
+        /**
+         * @brief Reads a field.
+         * @param bits Field width, 1 to 32.
+         */
+        std::uint32_t
+            read(int bits) {
+            while (m_scratchBits < bits) {
+                if (m_next < m_size) {
+                    m_scratch |= static_cast<std::uint64_t>(m_data[m_next++]) << m_scratchBits;
+                }
+                else {
+                    m_overflowed = true;
+                }
+                m_scratchBits += 8;
+            }
+            const std::uint32_t value = static_cast<std::uint32_t>(
+                bits < 32 ? m_scratch & ((static_cast<std::uint64_t>(1) << bits) - 1u) : m_scratch & 0xFFFFFFFFu);
+            m_scratch >>= bits;
+            m_scratchBits -= bits;
+            m_bitsRead += static_cast<std::size_t>(bits);
+            return value;
+        }
+
+        bool
+            readBool() {
+            return read(1) != 0;
+        }
+
+        float
+            readFloat() {
+            const std::uint32_t u = read(32);
+            float f;
+            std::memcpy(&f, &u, sizeof(f));
+            return f;
+        }
+
+        /**
+         * @brief Skips the rest of the current byte (matches BitWriter::flush()).
+         */
+        void
+            alignToByte() {
+            const int drop = m_scratchBits % 8;
+            m_scratch >>= drop;
+            m_scratchBits -= drop;
+            m_bitsRead += static_cast<std::size_t>(drop);
+        }
+
+        /**
+         * @brief Bytes of input used so far, counting a partially read byte.
+         */
+        std::size_t
+            bytesConsumed() const {
+            const std::size_t bytes = (m_bitsRead + 7) / 8;
+            return bytes < m_size ? bytes : m_size;
+        }
+
+        /**
+         * @brief True if a read went past the end of the data.
+         */
+        bool
+            overflowed() const {
+            return m_overflowed;
+        }
+
+    private:
+        const std::uint8_t* m_data;
+        std::size_t m_size;
+        std::size_t m_next;
+        std::uint64_t m_scratch;
+        int m_scratchBits;
+        std::size_t m_bitsRead;
+        bool m_overflowed;
+    };
+
+} // namespace EU
@@ -0,0 +1,55 @@
+#pragma once
+
+#include <SFML/Network/Packet.hpp>
+#include <Network/BitStream.h>
+
+/**
+ * @file PacketBits.h
+ * @brief BitWriter/BitReader bound to sf::Packet.
+ *
+ * Kept apart from BitStream.h so the serialization code does not depend on SFML.
+ * The writer appends straight into the packet's own storage; the reader decodes
+ * in place from the packet's current read position.
+ */
+
+namespace EU {
+
+    /**
+     * @brief sf::Packet already has append(const void*, std::size_t), so it is a sink.
+     */
+    typedef BitWriter<sf::Packet> PacketBitWriter;
+
+    /**
+     * @class PacketBitReader
+     * @brief Reads the bit stream starting at the packet's read position. Call
+     *        finish() afterwards to advance the packet past the bytes that were used,
+     *        so ordinary >> extraction can continue behind the bit stream.
+     */
+    class
+        PacketBitReader : public BitReader {
+    public:
+        explicit PacketBitReader(sf::Packet& packet)
+            : BitReader(static_cast<const char*>(packet.getData()) + packet.getReadPosition(),
+                        packet.getDataSize() - packet.getReadPosition()),
+              m_packet(&packet) {}
+
+        /**
+         * @brief Skips the packet's read position past the consumed bytes.
+         * @return False if the stream was truncated (a read overflowed).
+         */
+        bool
+            finish() {
+            alignToByte();
+            std::size_t remaining = bytesConsumed();
+            sf::Uint32 word;
+            sf::Uint8 byte;
+            for (; remaining >= 4; remaining -= 4) *m_packet >> word;
+            for (; remaining > 0; --remaining) *m_packet >> byte;
+            return !overflowed();
+        }
+
+    private:
+        sf::Packet* m_packet;
+    };
+
+} // namespace EU
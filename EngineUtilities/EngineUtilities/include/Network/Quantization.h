@@ -0,0 +1,148 @@
+#pragma once
+
+#include <cstdint>
+#include <Math/EngineMath.h>
+#include <Vectors/Vector3.h>
+#include <Rotations/Quaternion.h>
+#include <Network/BitStream.h>
+
+/**
+ * @file Quantization.h
+ * @brief Lossy encodings of floats, CVector3 and Quaternion for network
+ *        transforms, plus BitWriter/BitReader helpers.
+ */
+
+namespace EU {
+    namespace Quantize {
+
+        /**
+         * @brief Maps value in [min, max] (clamped) to an unsigned integer of the given
+         *        width, rounding to the nearest step.
+         */
+        inline std::uint32_t
+            encodeFloat(float value, float min, float max, int bits) {
+            const std::uint32_t steps = bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+            float t = (value - min) / (max - min);
+            // Written so NaN clamps to 0 as well.
+            t = t > 0.f ? (t < 1.f ? t : 1.f) : 0.f;
+            // In double: float(2^32 - 1) rounds up to 2^32, which overflows the cast at 32 bits.
+            return static_cast<std::uint32_t>(static_cast<double>(t) * static_cast<double>(steps) + 0.5);
+        }
+
+        inline float
+            decodeFloat(std::uint32_t q, float min, float max, int bits) {
+            const std::uint32_t steps = bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1u;
+            return min + (max - min) * (static_cast<float>(q) / static_cast<float>(steps));
+        }
+
+        /**
+         * @struct VectorRange
+         * @brief Axis-aligned bounds and precision of a quantized CVector3 (e.g. the
+         *        level bounds for positions, +-max speed for velocities).
+         */
+        struct
+            VectorRange {
+            CVector3 min;
+            CVector3 max;
+            int bits;               ///< Bits per component.
+
+            /**
+             * @brief Largest error per component: half a quantization step.
+             */
+            CVector3
+                precision() const {
+                const float steps = static_cast<float>((bits >= 32 ? 0xFFFFFFFFu : (1u << bits) - 1u));
+                return (max - min) / (2.f * steps);
+            }
+        };
+
+        /**
+         * @brief Component with the largest magnitude is dropped; the other three lie in
+         *        [-1/sqrt(2), 1/sqrt(2)].
+         */
+        constexpr float SMALLEST_THREE_RANGE = 0.70710678f;
+
+        /**
+         * @brief Smallest-three encoding of a unit quaternion: 2 bits for the index of
+         *        the dropped (largest) component, then three components of
+         *        bitsPerComponent bits (at most 10, so the code fits 32 bits). 9 bits
+         *        gives 29 bits total (error ~1.4e-3), 10 bits gives 32 (~7e-4).
+         */
+        inline std::uint32_t
+            encodeQuaternion(const Quaternion& q, int bitsPerComponent = 10) {
+            const float c[4] = { q.x, q.y, q.z, q.w };
+            int largest = 0;
+            for (int i = 1; i < 4; ++i) {
+                if (Math::abs(c[i]) > Math::abs(c[largest])) largest = i;
+            }
+            // q and -q are the same rotation: make the dropped component positive.
+            const float sign = c[largest] < 0.f ? -1.f : 1.f;
+            std::uint32_t packed = static_cast<std::uint32_t>(largest);
+            int shift = 2;
+            for (int i = 0; i < 4; ++i) {
+                if (i == largest) continue;
+                packed |= encodeFloat(c[i] * sign, -SMALLEST_THREE_RANGE, SMALLEST_THREE_RANGE, bitsPerComponent) << shift;
+                shift += bitsPerComponent;
+            }
+            return packed;
+        }
+
+        inline Quaternion
+            decodeQuaternion(std::uint32_t packed, int bitsPerComponent = 10) {
+            const int largest = static_cast<int>(packed & 3u);
+            const std::uint32_t mask = (1u << bitsPerComponent) - 1u;
+            float c[4];
+            float sumSq = 0.f;
+            int shift = 2;
+            for (int i = 0; i < 4; ++i) {
+                if (i == largest) continue;
+                c[i] = decodeFloat((packed >> shift) & mask, -SMALLEST_THREE_RANGE, SMALLEST_THREE_RANGE, bitsPerComponent);
+                sumSq += c[i] * c[i];
+                shift += bitsPerComponent;
+            }
+            c[largest] = Math::sqrt(1.f - sumSq > 0.f ? 1.f - sumSq : 0.f);
+            return Quaternion(c[0], c[1], c[2], c[3]);
+        }
+
+        // Stream helpers
+
+        template<class Sink>
+        inline void
+            writeFloat(BitWriter<Sink>& writer, float value, float min, float max, int bits) {
+            writer.write(encodeFloat(value, min, max, bits), bits);
+        }
+
+        inline float
+            readFloat(BitReader& reader, float min, float max, int bits) {
+            return decodeFloat(reader.read(bits), min, max, bits);
+        }
+
+        template<class Sink>
+        inline void
+            writeVector(BitWriter<Sink>& writer, const CVector3& v, const VectorRange& range) {
+            writer.write(encodeFloat(v.x, range.min.x, range.max.x, range.bits), range.bits);
+            writer.write(encodeFloat(v.y, range.min.y, range.max.y, range.bits), range.bits);
+            writer.write(encodeFloat(v.z, range.min.z, range.max.z, range.bits), range.bits);
+        }
+
+        inline CVector3
+            readVector(BitReader& reader, const VectorRange& range) {
+            const float x = decodeFloat(reader.read(range.bits), range.min.x, range.max.x, range.bits);
+            const float y = decodeFloat(reader.read(range.bits), range.min.y, range.max.y, range.bits);
+            const float z = decodeFloat(reader.read(range.bits), range.min.z, range.max.z, range.bits);
+            return CVector3(x, y, z);
+        }
+
+        template<class Sink>
+        inline void
+            writeQuaternion(BitWriter<Sink>& writer, const Quaternion& q, int bitsPerComponent = 10) {
+            writer.write(encodeQuaternion(q, bitsPerComponent), 2 + 3 * bitsPerComponent);
+        }
+
+        inline Quaternion
+            readQuaternion(BitReader& reader, int bitsPerComponent = 10) {
+            return decodeQuaternion(reader.read(2 + 3 * bitsPerComponent), bitsPerComponent);
+        }
+
+    } // namespace Quantize
+} // namespace EU
@@ -0,0 +1,393 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include <Core/SIMD.h>
+#include <Vectors/Vector3.h>
+#include <Rotations/Quaternion.h>
+#include <Network/BitStream.h>
+#include <Network/Quantization.h>
+
+/**
+ * @file Snapshot.h
+ * @brief Quantized transform snapshots and delta compression against a
+ *        client-acknowledged baseline.
+ *
+ * The server captures one TransformSnapshot per tick (quantization happens once,
+ * not per client), keeps recent ones in a SnapshotHistory, and for every client
+ * encodes the current snapshot against the last one that client acknowledged.
+ * Unchanged entities are found with a SIMD compare of the quantized SoA streams
+ * and cost nothing but the gap before the next changed one.
+ */
+
+namespace EU {
+
+    /**
+     * @struct SnapshotFormat
+     * @brief Quantization shared by server and clients.
+     *
+     * Entity count, changed count and gaps are sent in 16 bits, so a snapshot holds
+     * at most MAX_ENTITIES entities; SnapshotDelta::encode() refuses larger ones.
+     */
+    struct
+        SnapshotFormat {
+        static constexpr int MAX_ENTITIES = 65535;
+
+        Quantize::VectorRange position;     ///< bits at most 24.
+        int rotationBits = 9;               ///< Smallest-three bits per component, at most 10.
+    };
+
+    /**
+     * @class TransformSnapshot
+     * @brief Quantized positions and rotations of every entity, one uint32 stream per
+     *        component, padded to SIMD::LANES.
+     */
+    class
+        TransformSnapshot {
+    public:
+        /**
+         * @brief Index of each stream.
+         */
+        enum
+            Stream {
+            PX, PY, PZ,         ///< Quantized position.
+            ROTATION,           ///< Smallest-three quaternion code.
+            STREAM_COUNT
+        };
+
+        TransformSnapshot() : m_count(0) {}
+
+        explicit TransformSnapshot(int count) : m_count(0) {
+            resize(count);
+        }
+
+        /**
+         * @brief Changes the entity count; every value becomes 0.
+         */
+        void
+            resize(int count) {
+            m_count = count;
+            const std::size_t padded = static_cast<std::size_t>((count + SIMD::LANES - 1) / SIMD::LANES * SIMD::LANES);
+            for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s].assign(padded, 0u);
+        }
+
+        int
+            count() const {
+            return m_count;
+        }
+
+        int
+            paddedCount() const {
+            return static_cast<int>(m_streams[PX].size());
+        }
+
+        std::uint32_t*
+            stream(Stream s) {
+            return m_streams[s].data();
+        }
+
+        const std::uint32_t*
+            stream(Stream s) const {
+            return m_streams[s].data();
+        }
+
+        /**
+         * @brief Quantizes transforms given as SoA float streams (e.g. RigidBodySet
+         *        streams). Positions are quantized four at a time.
+         */
+        void
+            capture(const float* px, const float* py, const float* pz,
+                    const float* qx, const float* qy, const float* qz, const float* qw,
+                    int count, const SnapshotFormat& format) {
+            if (count != m_count) resize(count);
+            const float* in[3] = { px, py, pz };
+            const float mins[3] = { format.position.min.x, format.position.min.y, format.position.min.z };
+            const float maxs[3] = { format.position.max.x, format.position.max.y, format.position.max.z };
+            const float steps = static_cast<float>((1u << format.position.bits) - 1u);
+            for (int c = 0; c < 3; ++c) {
+                quantizeStream(in[c], m_streams[PX + c].data(), count, mins[c], steps / (maxs[c] - mins[c]), steps);
+            }
+            for (int i = 0; i < count; ++i) {
+                m_streams[ROTATION][i] = Quantize::encodeQuaternion(Quaternion(qx[i], qy[i], qz[i], qw[i]), format.rotationBits);
+            }
+        }
+
+        /**
+         * @brief Quantizes transforms given as arrays of CVector3 and Quaternion.
+         */
+        void
+            capture(const CVector3* positions, const Quaternion* rotations, int count, const SnapshotFormat& format) {
+            if (count != m_count) resize(count);
+            const float steps = static_cast<float>((1u << format.position.bits) - 1u);
+            const float mins[3] = { format.position.min.x, format.position.min.y, format.position.min.z };
+            const float maxs[3] = { format.position.max.x, format.position.max.y, format.position.max.z };
+            for (int i = 0; i < count; ++i) {
+                const float p[3] = { positions[i].x, positions[i].y, positions[i].z };
+                for (int c = 0; c < 3; ++c) {
+                    m_streams[PX + c][i] = quantize(p[c], mins[c], steps / (maxs[c] - mins[c]), steps);
+                }
+                m_streams[ROTATION][i] = Quantize::encodeQuaternion(rotations[i], format.rotationBits);
+            }
+        }
+
+        CVector3
+            position(int i, const SnapshotFormat& format) const {
+            const Quantize::VectorRange& r = format.position;
+            return CVector3(Quantize::decodeFloat(m_streams[PX][i], r.min.x, r.max.x, r.bits),
+                            Quantize::decodeFloat(m_streams[PY][i], r.min.y, r.max.y, r.bits),
+                            Quantize::decodeFloat(m_streams[PZ][i], r.min.z, r.max.z, r.bits));
+        }
+
+        Quaternion
+            rotation(int i, const SnapshotFormat& format) const {
+            return Quantize::decodeQuaternion(m_streams[ROTATION][i], format.rotationBits);
+        }
+
+    private:
+        static std::uint32_t
+            quantize(float value, float min, float scale, float steps) {
+            float t = (value - min) * scale;
+            t = t < 0.f ? 0.f : (t > steps ? steps : t);
+            return static_cast<std::uint32_t>(t + 0.5f);
+        }
+
+        static void
+            quantizeStream(const float* in, std::uint32_t* out, int count, float min, float scale, float steps) {
+            using SIMD::float4;
+            const float4 vMin(min), vScale(scale), vSteps(steps), half(0.5f);
+            int i = 0;
+            for (; i + SIMD::LANES <= count; i += SIMD::LANES) {
+                const float4 t = SIMD::min(SIMD::max((float4::loadu(in + i) - vMin) * vScale, float4::zero()), vSteps);
+                SIMD::toInt(t + half).storeu(reinterpret_cast<int*>(out + i));
+            }
+            for (; i < count; ++i) out[i] = quantize(in[i], min, scale, steps);
+        }
+
+        std::vector<std::uint32_t> m_streams[STREAM_COUNT];
+        int m_count;
+    };
+
+    /**
+     * @class SnapshotHistory
+     * @brief Ring of the most recent snapshots, looked up by tick sequence number to
+     *        find a client's acknowledged baseline.
+     */
+    class
+        SnapshotHistory {
+    public:
+        explicit SnapshotHistory(int capacity = 32) : m_snapshots(capacity), m_sequences(capacity, -1) {}
+
+        /**
+         * @brief Slot for the snapshot of a new tick; overwrites the oldest one.
+         */
+        TransformSnapshot&
+            store(int sequence) {
+            const int slot = sequence % static_cast<int>(m_snapshots.size());
+            m_sequences[slot] = sequence;
+            return m_snapshots[slot];
+        }
+
+        /**
+         * @brief Snapshot of a tick, or nullptr if it was never stored or is too old
+         *        (then the client gets a full snapshot).
+         */
+        const TransformSnapshot*
+            find(int sequence) const {
+            if (sequence < 0) return nullptr;
+            const int slot = sequence % static_cast<int>(m_snapshots.size());
+            return m_sequences[slot] == sequence ? &m_snapshots[slot] : nullptr;
+        }
+
+    private:
+        std::vector<TransformSnapshot> m_snapshots;
+        std::vector<int> m_sequences;
+    };
+
+    namespace SnapshotDelta {
+
+        namespace detail {
+
+            inline std::uint32_t
+                zigzag(std::uint32_t delta) {
+                const std::int32_t d = static_cast<std::int32_t>(delta);
+                return (delta << 1) ^ static_cast<std::uint32_t>(d >> 31);
+            }
+
+            inline std::uint32_t
+                unzigzag(std::uint32_t z) {
+                return (z >> 1) ^ (0u - (z & 1u));
+            }
+
+            /**
+             * @brief Gap to the next changed entity: 2-bit size class then 0, 4, 8 or 16 bits.
+             */
+            template<class Sink>
+            inline void
+                writeGap(BitWriter<Sink>& writer, std::uint32_t gap) {
+                if (gap == 0) { writer.write(0u, 2); return; }
+                if (gap < 16) { writer.write(1u, 2); writer.write(gap, 4); return; }
+                if (gap < 256) { writer.write(2u, 2); writer.write(gap, 8); return; }
+                writer.write(3u, 2);
+                writer.write(gap, 16);
+            }
+
+            inline std::uint32_t
+                readGap(BitReader& reader) {
+                static const int widths[4] = { 0, 4, 8, 16 };
+                const int cls = static_cast<int>(reader.read(2));
+                return cls == 0 ? 0u : reader.read(widths[cls]);
+            }
+
+            /**
+             * @brief One position axis: 2-bit class (unchanged, 6-bit delta, 12-bit delta,
+             *        absolute value) then the payload.
+             */
+            template<class Sink>
+            inline void
+                writeAxis(BitWriter<Sink>& writer, std::uint32_t current, std::uint32_t base, int bits) {
+                const std::uint32_t z = zigzag(current - base);
+                if (z == 0) { writer.write(0u, 2); return; }
+                if (z < 64) { writer.write(1u, 2); writer.write(z, 6); return; }
+                if (z < 4096 && bits > 12) { writer.write(2u, 2); writer.write(z, 12); return; }
+                writer.write(3u, 2);
+                writer.write(current, bits);
+            }
+
+            inline std::uint32_t
+                readAxis(BitReader& reader, std::uint32_t base, int bits) {
+                switch (reader.read(2)) {
+                case 0: return base;
+                case 1: return base + unzigzag(reader.read(6));
+                case 2: return base + unzigzag(reader.read(12));
+                default: return reader.read(bits);
+                }
+            }
+
+        } // namespace detail
+
+        /**
+         * @brief Marks the entities whose quantized transform differs from the baseline,
+         *        comparing four entities per step.
+         * @param changed One bit per entity, (paddedCount() / 32 + 1) words.
+         * @return Number of changed entities.
+         */
+        inline int
+            findChanged(const TransformSnapshot& current, const TransformSnapshot& baseline, std::vector<std::uint32_t>& changed) {
+            using SIMD::int4;
+            const int n = current.paddedCount();
+            changed.assign(static_cast<std::size_t>(n / 32 + 1), 0u);
+            int total = 0;
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                int4 same = int4(-1);
+                for (int s = 0; s < TransformSnapshot::STREAM_COUNT; ++s) {
+                    const TransformSnapshot::Stream st = static_cast<TransformSnapshot::Stream>(s);
+                    same = same & (int4::loadu(reinterpret_cast<const int*>(current.stream(st) + i)) ==
+                                   int4::loadu(reinterpret_cast<const int*>(baseline.stream(st) + i)));
+                }
+                int bits = ~SIMD::movemask(SIMD::asFloat(same)) & 0xF;
+                if (i + SIMD::LANES > current.count()) bits &= (1 << (current.count() - i)) - 1;
+                if (bits == 0) continue;
+                changed[static_cast<std::size_t>(i / 32)] |= static_cast<std::uint32_t>(bits) << (i % 32);
+                total += ((bits >> 0) & 1) + ((bits >> 1) & 1) + ((bits >> 2) & 1) + ((bits >> 3) & 1);
+            }
+            return total;
+        }
+
+        /**
+         * @struct EncodeScratch
+         * @brief Buffers reused across encode() calls (one per server thread), so
+         *        encoding every client every tick does not allocate once warmed up.
+         */
+        struct
+            EncodeScratch {
+            TransformSnapshot zero;                 ///< All-zero baseline for full snapshots.
+            std::vector<std::uint32_t> changed;     ///< findChanged() bits.
+        };
+
+        /**
+         * @brief Writes current as a delta against baseline.
+         * @param baseline Last snapshot the client acknowledged with the same entity
+         *        count, or nullptr for a full snapshot (delta against all zeros).
+         * @return False (nothing written) if current has more than
+         *         SnapshotFormat::MAX_ENTITIES entities.
+         */
+        template<class Sink>
+        inline bool
+            encode(BitWriter<Sink>& writer, const TransformSnapshot& current, const TransformSnapshot* baseline,
+                   const SnapshotFormat& format, EncodeScratch& scratch) {
+            if (current.count() > SnapshotFormat::MAX_ENTITIES) return false;
+            if (!baseline || baseline->count() != current.count()) {
+                // resize() zeroes, and nothing ever writes to the zero baseline.
+                if (scratch.zero.count() != current.count()) scratch.zero.resize(current.count());
+                baseline = &scratch.zero;
+            }
+            std::vector<std::uint32_t>& changed = scratch.changed;
+            const int total = findChanged(current, *baseline, changed);
+            writer.write(static_cast<std::uint32_t>(current.count()), 16);
+            writer.write(static_cast<std::uint32_t>(total), 16);
+
+            const int rotationWidth = 2 + 3 * format.rotationBits;
+            int previous = -1;
+            for (std::size_t w = 0; w < changed.size(); ++w) {
+                std::uint32_t word = changed[w];
+                while (word) {
+                    int bit = 0;
+                    while (!((word >> bit) & 1u)) ++bit;
+                    word &= word - 1u;
+                    const int i = static_cast<int>(w * 32) + bit;
+                    detail::writeGap(writer, static_cast<std::uint32_t>(i - previous - 1));
+                    previous = i;
+
+                    for (int c = 0; c < 3; ++c) {
+                        const TransformSnapshot::Stream st = static_cast<TransformSnapshot::Stream>(TransformSnapshot::PX + c);
+                        detail::writeAxis(writer, current.stream(st)[i], baseline->stream(st)[i], format.position.bits);
+                    }
+                    const std::uint32_t rotation = current.stream(TransformSnapshot::ROTATION)[i];
+                    const bool rotationChanged = rotation != baseline->stream(TransformSnapshot::ROTATION)[i];
+                    writer.writeBool(rotationChanged);
+                    if (rotationChanged) writer.write(rotation, rotationWidth);
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief encode() with temporary buffers; allocates on every call.
+         */
+        template<class Sink>
+        inline bool
+            encode(BitWriter<Sink>& writer, const TransformSnapshot& current, const TransformSnapshot* baseline,
+                   const SnapshotFormat& format) {
+            EncodeScratch scratch;
+            return encode(writer, current, baseline, format, scratch);
+        }
+
+        /**
+         * @brief Rebuilds a snapshot from a delta.
+         * @param baseline The snapshot the delta was encoded against (nullptr if full).
+         * @return False if the message was truncated or does not match the baseline.
+         */
+        inline bool
+            decode(BitReader& reader, const TransformSnapshot* baseline, TransformSnapshot& out, const SnapshotFormat& format) {
+            const int count = static_cast<int>(reader.read(16));
+            const int total = static_cast<int>(reader.read(16));
+            if (baseline && baseline->count() == count) out = *baseline;
+            else out.resize(count);
+
+            const int rotationWidth = 2 + 3 * format.rotationBits;
+            int i = -1;
+            for (int k = 0; k < total; ++k) {
+                i += static_cast<int>(detail::readGap(reader)) + 1;
+                if (i >= count || reader.overflowed()) return false;
+                for (int c = 0; c < 3; ++c) {
+                    std::uint32_t* s = out.stream(static_cast<TransformSnapshot::Stream>(TransformSnapshot::PX + c));
+                    s[i] = detail::readAxis(reader, s[i], format.position.bits);
+                }
+                if (reader.readBool()) out.stream(TransformSnapshot::ROTATION)[i] = reader.read(rotationWidth);
+            }
+            return !reader.overflowed();
+        }
+
+    } // namespace SnapshotDelta
+
+} // namespace EU
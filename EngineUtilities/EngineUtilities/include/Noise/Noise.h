@@ -0,0 +1,387 @@
+#pragma once
+
+#include <cstddef>
+#include <Core/SIMD.h>
+
+/**
+ * @file Noise.h
+ * @brief Gradient (Perlin) and simplex noise in 2D and 3D evaluated four samples
+ *        per call, fBm and ridged fractals, and whole-grid fills.
+ */
+
+namespace EU {
+    namespace Noise {
+
+        /**
+         * @brief Basis function of a fractal.
+         */
+        enum class
+            NoiseType {
+            Perlin2D,       ///< Improved Perlin gradient noise on (x, y).
+            Perlin3D,       ///< Improved Perlin gradient noise on (x, y, z).
+            Simplex2D,      ///< Simplex noise on (x, y); cheaper, fewer axis-aligned artifacts.
+            Simplex3D       ///< Simplex noise on (x, y, z).
+        };
+
+        /**
+         * @brief How the octaves of a fractal are combined.
+         */
+        enum class
+            FractalMode {
+            FBm,            ///< Sum of octaves, normalized to roughly [-1, 1].
+            Ridged          ///< Musgrave ridged multifractal, in [0, 1]; sharp crests.
+        };
+
+        /**
+         * @struct FractalSettings
+         * @brief Parameters of fractal() and the grid fills.
+         */
+        struct
+            FractalSettings {
+            NoiseType type = NoiseType::Perlin3D;
+            FractalMode mode = FractalMode::FBm;
+            int octaves = 4;
+            float frequency = 1.f;      ///< Frequency of the first octave.
+            float lacunarity = 2.f;     ///< Frequency multiplier between octaves.
+            float gain = 0.5f;          ///< Amplitude multiplier between octaves.
+            int seed = 0;               ///< Octave o uses seed + o.
+        };
+
+        /**
+         * @struct NoiseGrid
+         * @brief Regular grid of sample positions, row-major. Sample (c, r) is at
+         *        (originX + c * stepX, originY + r * stepY, z).
+         */
+        struct
+            NoiseGrid {
+            int width = 0;
+            int height = 0;
+            float originX = 0.f;
+            float originY = 0.f;
+            float stepX = 1.f;
+            float stepY = 1.f;
+            float z = 0.f;              ///< Slice coordinate for the 3D noise types.
+        };
+
+        namespace detail {
+
+            using SIMD::float4;
+            using SIMD::int4;
+
+            /**
+             * @brief Integer hash of a lattice point. Replaces the permutation table so the
+             *        four lanes need no gathers, and makes every seed a different pattern.
+             */
+            inline int4
+                hash(const int4& seed, const int4& ix, const int4& iy, const int4& iz) {
+                int4 h = seed ^ (ix * int4(501125321)) ^ (iy * int4(1136930381)) ^ (iz * int4(1720413743));
+                h = h * int4(0x27d4eb2d);
+                return h ^ SIMD::shiftRight<15>(h);
+            }
+
+            /**
+             * @brief Flips the sign of the lanes of v whose given hash bit is set.
+             */
+            template<int BIT>
+            inline float4
+                flipSign(const int4& h, const float4& v) {
+                return v ^ SIMD::asFloat(SIMD::shiftLeft<31 - BIT>(h & int4(1 << BIT)));
+            }
+
+            /**
+             * @brief Dot product with one of the gradients (+-1, +-2), (+-2, +-1).
+             */
+            inline float4
+                gradient(const int4& h, const float4& x, const float4& y) {
+                const float4 xFirst = SIMD::asFloat((h & int4(4)) == int4(0));
+                const float4 u = SIMD::select(xFirst, x, y);
+                const float4 v = SIMD::select(xFirst, y, x);
+                return flipSign<0>(h, u) + flipSign<1>(h, v + v);
+            }
+
+            /**
+             * @brief Dot product with one of Perlin's 12 cube-edge gradients (4 repeated
+             *        to fill 16 slots).
+             */
+            inline float4
+                gradient(const int4& h, const float4& x, const float4& y, const float4& z) {
+                const int4 b = h & int4(15);
+                const float4 u = SIMD::select(SIMD::asFloat(b < int4(8)), x, y);
+                const float4 useX = SIMD::asFloat((b == int4(12)) | (b == int4(14)));
+                const float4 v = SIMD::select(SIMD::asFloat(b < int4(4)), y, SIMD::select(useX, x, z));
+                return flipSign<0>(h, u) + flipSign<1>(h, v);
+            }
+
+            /**
+             * @brief Quintic fade curve 6t^5 - 15t^4 + 10t^3.
+             */
+            inline float4
+                fade(const float4& t) {
+                return t * t * t * SIMD::madd(t, SIMD::madd(t, float4(6.f), float4(-15.f)), float4(10.f));
+            }
+
+            inline float4
+                lerp(const float4& a, const float4& b, const float4& t) {
+                return SIMD::madd(b - a, t, a);
+            }
+
+            /**
+             * @brief Contribution of one simplex corner: max(0, r2 - d^2)^4 * gradient.
+             */
+            inline float4
+                corner(const float4& r2, const int4& h, const float4& x, const float4& y) {
+                const float4 t = SIMD::max(r2 - SIMD::madd(x, x, y * y), float4::zero());
+                const float4 t2 = t * t;
+                return t2 * t2 * gradient(h, x, y);
+            }
+
+            inline float4
+                corner(const float4& r2, const int4& h, const float4& x, const float4& y, const float4& z) {
+                const float4 t = SIMD::max(r2 - SIMD::dot3(x, y, z, x, y, z), float4::zero());
+                const float4 t2 = t * t;
+                return t2 * t2 * gradient(h, x, y, z);
+            }
+
+            /**
+             * @brief 1 in the lanes where the mask is set, 0 elsewhere.
+             */
+            inline int4
+                bit(const float4& mask) {
+                return SIMD::asInt(mask) & int4(1);
+            }
+
+        } // namespace detail
+
+        /**
+         * @brief 2D Perlin noise of four points, roughly in [-1, 1].
+         */
+        inline SIMD::float4
+            perlin2(const SIMD::float4& x, const SIMD::float4& y, int seed = 0) {
+            using SIMD::float4;
+            using SIMD::int4;
+            using namespace detail;
+            const float4 fx = SIMD::floor(x), fy = SIMD::floor(y);
+            const int4 ix = SIMD::toInt(fx), iy = SIMD::toInt(fy);
+            const int4 ix1 = ix + int4(1), iy1 = iy + int4(1), s(seed), zero;
+            const float4 x0 = x - fx, y0 = y - fy;
+            const float4 x1 = x0 - float4(1.f), y1 = y0 - float4(1.f);
+            const float4 u = fade(x0), v = fade(y0);
+
+            const float4 n00 = gradient(hash(s, ix, iy, zero), x0, y0);
+            const float4 n10 = gradient(hash(s, ix1, iy, zero), x1, y0);
+            const float4 n01 = gradient(hash(s, ix, iy1, zero), x0, y1);
+            const float4 n11 = gradient(hash(s, ix1, iy1, zero), x1, y1);
+            return lerp(lerp(n00, n10, u), lerp(n01, n11, u), v) * float4(0.65f);
+        }
+
+        /**
+         * @brief 3D Perlin noise of four points, roughly in [-1, 1].
+         */
+        inline SIMD::float4
+            perlin3(const SIMD::float4& x, const SIMD::float4& y, const SIMD::float4& z, int seed = 0) {
+            using SIMD::float4;
+            using SIMD::int4;
+            using namespace detail;
+            const float4 fx = SIMD::floor(x), fy = SIMD::floor(y), fz = SIMD::floor(z);
+            const int4 ix = SIMD::toInt(fx), iy = SIMD::toInt(fy), iz = SIMD::toInt(fz);
+            const int4 ix1 = ix + int4(1), iy1 = iy + int4(1), iz1 = iz + int4(1), s(seed);
+            const float4 x0 = x - fx, y0 = y - fy, z0 = z - fz;
+            const float4 one(1.f);
+            const float4 x1 = x0 - one, y1 = y0 - one, z1 = z0 - one;
+            const float4 u = fade(x0), v = fade(y0), w = fade(z0);
+
+            const float4 n000 = gradient(hash(s, ix, iy, iz), x0, y0, z0);
+            const float4 n100 = gradient(hash(s, ix1, iy, iz), x1, y0, z0);
+            const float4 n010 = gradient(hash(s, ix, iy1, iz), x0, y1, z0);
+            const float4 n110 = gradient(hash(s, ix1, iy1, iz), x1, y1, z0);
+            const float4 n001 = gradient(hash(s, ix, iy, iz1), x0, y0, z1);
+            const float4 n101 = gradient(hash(s, ix1, iy, iz1), x1, y0, z1);
+            const float4 n011 = gradient(hash(s, ix, iy1, iz1), x0, y1, z1);
+            const float4 n111 = gradient(hash(s, ix1, iy1, iz1), x1, y1, z1);
+            return lerp(lerp(lerp(n000, n100, u), lerp(n010, n110, u), v),
+                        lerp(lerp(n001, n101, u), lerp(n011, n111, u), v), w);
+        }
+
+        /**
+         * @brief 2D simplex noise of four points, roughly in [-1, 1].
+         */
+        inline SIMD::float4
+            simplex2(const SIMD::float4& x, const SIMD::float4& y, int seed = 0) {
+            using SIMD::float4;
+            using SIMD::int4;
+            using namespace detail;
+            const float F2 = 0.36602540378f;    // (sqrt(3) - 1) / 2
+            const float G2 = 0.21132486540f;    // (3 - sqrt(3)) / 6
+
+            // Skew to the square lattice, find the cell, unskew back.
+            const float4 skew = (x + y) * float4(F2);
+            const float4 fi = SIMD::floor(x + skew), fj = SIMD::floor(y + skew);
+            const float4 unskew = (fi + fj) * float4(G2);
+            const float4 x0 = x - fi + unskew, y0 = y - fj + unskew;
+
+            // Lower or upper triangle of the cell.
+            const float4 lower = x0 > y0;
+            const int4 i1 = bit(lower), j1 = int4(1) - i1;
+            const float4 fi1 = SIMD::toFloat(i1), fj1 = SIMD::toFloat(j1);
+            const float4 x1 = x0 - fi1 + float4(G2), y1 = y0 - fj1 + float4(G2);
+            const float4 x2 = x0 - float4(1.f - 2.f * G2), y2 = y0 - float4(1.f - 2.f * G2);
+
+            const int4 i = SIMD::toInt(fi), j = SIMD::toInt(fj), s(seed), zero;
+            const float4 r2(0.5f);
+            const float4 n = corner(r2, hash(s, i, j, zero), x0, y0)
+                + corner(r2, hash(s, i + i1, j + j1, zero), x1, y1)
+                + corner(r2, hash(s, i + int4(1), j + int4(1), zero), x2, y2);
+            return n * float4(45.23f);
+        }
+
+        /**
+         * @brief 3D simplex noise of four points, roughly in [-1, 1].
+         */
+        inline SIMD::float4
+            simplex3(const SIMD::float4& x, const SIMD::float4& y, const SIMD::float4& z, int seed = 0) {
+            using SIMD::float4;
+            using SIMD::int4;
+            using namespace detail;
+            const float F3 = 1.f / 3.f;
+            const float G3 = 1.f / 6.f;
+
+            const float4 skew = (x + y + z) * float4(F3);
+            const float4 fi = SIMD::floor(x + skew), fj = SIMD::floor(y + skew), fk = SIMD::floor(z + skew);
+            const float4 unskew = (fi + fj + fk) * float4(G3);
+            const float4 x0 = x - fi + unskew, y0 = y - fj + unskew, z0 = z - fk + unskew;
+
+            // Which of the six tetrahedra of the cube: order the offsets, branch-free.
+            const int4 xy = bit(x0 >= y0), yz = bit(y0 >= z0), xz = bit(x0 >= z0), one(1);
+            const int4 i1 = xy & xz, j1 = (one - xy) & yz, k1 = (one - xz) & (one - yz);
+            const int4 i2 = xy | xz, j2 = (one - xy) | yz, k2 = one - (xz & yz);
+
+            const float4 g1(G3), g2(2.f * G3), g3(3.f * G3 - 1.f);
+            const float4 x1 = x0 - SIMD::toFloat(i1) + g1, y1 = y0 - SIMD::toFloat(j1) + g1, z1 = z0 - SIMD::toFloat(k1) + g1;
+            const float4 x2 = x0 - SIMD::toFloat(i2) + g2, y2 = y0 - SIMD::toFloat(j2) + g2, z2 = z0 - SIMD::toFloat(k2) + g2;
+            const float4 x3 = x0 + g3, y3 = y0 + g3, z3 = z0 + g3;
+
+            const int4 i = SIMD::toInt(fi), j = SIMD::toInt(fj), k = SIMD::toInt(fk), s(seed);
+            const float4 r2(0.6f);
+            const float4 n = corner(r2, hash(s, i, j, k), x0, y0, z0)
+                + corner(r2, hash(s, i + i1, j + j1, k + k1), x1, y1, z1)
+                + corner(r2, hash(s, i + i2, j + j2, k + k2), x2, y2, z2)
+                + corner(r2, hash(s, i + one, j + one, k + one), x3, y3, z3);
+            return n * float4(32.f);
+        }
+
+        inline float
+            perlin2(float x, float y, int seed = 0) {
+            return perlin2(SIMD::float4(x), SIMD::float4(y), seed).lane(0);
+        }
+
+        inline float
+            perlin3(float x, float y, float z, int seed = 0) {
+            return perlin3(SIMD::float4(x), SIMD::float4(y), SIMD::float4(z), seed).lane(0);
+        }
+
+        inline float
+            simplex2(float x, float y, int seed = 0) {
+            return simplex2(SIMD::float4(x), SIMD::float4(y), seed).lane(0);
+        }
+
+        inline float
+            simplex3(float x, float y, float z, int seed = 0) {
+            return simplex3(SIMD::float4(x), SIMD::float4(y), SIMD::float4(z), seed).lane(0);
+        }
+
+        /**
+         * @brief Evaluates the basis selected by type; 2D types ignore z.
+         */
+        inline SIMD::float4
+            evaluate(NoiseType type, const SIMD::float4& x, const SIMD::float4& y, const SIMD::float4& z, int seed) {
+            switch (type) {
+            case NoiseType::Perlin2D: return perlin2(x, y, seed);
+            case NoiseType::Perlin3D: return perlin3(x, y, z, seed);
+            case NoiseType::Simplex2D: return simplex2(x, y, seed);
+            case NoiseType::Simplex3D: return simplex3(x, y, z, seed);
+            }
+            return SIMD::float4::zero();
+        }
+
+        /**
+         * @brief Fractal noise of four points. Frequency and amplitude are stepped by
+         *        multiplication per octave, so there is no pow() in the loop.
+         */
+        inline SIMD::float4
+            fractal(const SIMD::float4& x, const SIMD::float4& y, const SIMD::float4& z, const FractalSettings& settings) {
+            using SIMD::float4;
+            float frequency = settings.frequency;
+            float amplitude = 1.f;
+            float total = 0.f;
+            float4 sum = float4::zero();
+            if (settings.mode == FractalMode::FBm) {
+                for (int o = 0; o < settings.octaves; ++o) {
+                    const float4 f(frequency);
+                    sum = SIMD::madd(evaluate(settings.type, x * f, y * f, z * f, settings.seed + o), float4(amplitude), sum);
+                    total += amplitude;
+                    frequency *= settings.lacunarity;
+                    amplitude *= settings.gain;
+                }
+            }
+            else {
+                // Each octave is weighted by the previous one, so detail gathers on the ridges.
+                const float4 one(1.f);
+                float4 weight = one;
+                for (int o = 0; o < settings.octaves; ++o) {
+                    const float4 f(frequency);
+                    float4 signal = one - SIMD::abs(evaluate(settings.type, x * f, y * f, z * f, settings.seed + o));
+                    signal = signal * signal * weight;
+                    weight = SIMD::min(SIMD::max(signal * float4(2.f), float4::zero()), one);
+                    sum = SIMD::madd(signal, float4(amplitude), sum);
+                    total += amplitude;
+                    frequency *= settings.lacunarity;
+                    amplitude *= settings.gain;
+                }
+            }
+            return total > 0.f ? sum * float4(1.f / total) : sum;
+        }
+
+        inline float
+            fractal(float x, float y, float z, const FractalSettings& settings) {
+            return fractal(SIMD::float4(x), SIMD::float4(y), SIMD::float4(z), settings).lane(0);
+        }
+
+        /**
+         * @brief Fills rows [firstRow, lastRow) of a grid, four samples per call.
+         *
+         * out points at the whole grid (width * height floats). Rows are independent,
+         * so large grids can be split with JobSystem::parallel_for(0, grid.height,
+         * [&](int a, int b) { fillRows(grid, settings, a, b, out); }).
+         */
+        inline void
+            fillRows(const NoiseGrid& grid, const FractalSettings& settings, int firstRow, int lastRow, float* out) {
+            using SIMD::float4;
+            const float4 laneOffset = float4(0.f, 1.f, 2.f, 3.f) * float4(grid.stepX);
+            const float4 z(grid.z);
+            for (int r = firstRow; r < lastRow; ++r) {
+                const float4 y(grid.originY + static_cast<float>(r) * grid.stepY);
+                float* row = out + static_cast<std::size_t>(r) * static_cast<std::size_t>(grid.width);
+                int c = 0;
+                for (; c + SIMD::LANES <= grid.width; c += SIMD::LANES) {
+                    const float4 x = float4(grid.originX + static_cast<float>(c) * grid.stepX) + laneOffset;
+                    fractal(x, y, z, settings).storeu(row + c);
+                }
+                if (c < grid.width) {
+                    alignas(16) float tail[SIMD::LANES];
+                    const float4 x = float4(grid.originX + static_cast<float>(c) * grid.stepX) + laneOffset;
+                    fractal(x, y, z, settings).store(tail);
+                    for (int l = 0; c + l < grid.width; ++l) row[c + l] = tail[l];
+                }
+            }
+        }
+
+        /**
+         * @brief Fills the whole grid (width * height floats, row-major).
+         */
+        inline void
+            fillGrid(const NoiseGrid& grid, const FractalSettings& settings, float* out) {
+            fillRows(grid, settings, 0, grid.height, out);
+        }
+
+    } // namespace Noise
+} // namespace EU
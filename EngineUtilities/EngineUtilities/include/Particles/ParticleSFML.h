@@ -0,0 +1,103 @@
+#pragma once
+
+#include <SFML/Graphics/VertexArray.hpp>
+#include <Particles/ParticleSystem.h>
+
+/**
+ * @file ParticleSFML.h
+ * @brief Writes a ParticleSystem straight into an sf::VertexArray.
+ *
+ * Kept apart from ParticleSystem.h so the simulation does not depend on SFML.
+ * Positions use the x and y streams as-is (already in world/view units). The
+ * vertex array keeps its capacity when it shrinks, so exporting every frame does
+ * not allocate once the pool has reached its steady size.
+ */
+
+namespace EU {
+    namespace ParticleExport {
+
+        /**
+         * @brief Converts four particles' colour channels into sf::Color values.
+         */
+        inline void
+            colors(const ParticleSystem& system, int i, sf::Color out[SIMD::LANES]) {
+            using SIMD::float4;
+            const float4 scale(255.f), half(0.5f);
+            alignas(16) float c[4][SIMD::LANES];
+            for (int ch = 0; ch < 4; ++ch) {
+                const ParticleSystem::Stream s = static_cast<ParticleSystem::Stream>(ParticleSystem::R + ch);
+                madd(float4::loadu(system.stream(s) + i), scale, half).store(c[ch]);
+            }
+            for (int k = 0; k < SIMD::LANES; ++k) {
+                out[k] = sf::Color(static_cast<sf::Uint8>(c[0][k]), static_cast<sf::Uint8>(c[1][k]),
+                                   static_cast<sf::Uint8>(c[2][k]), static_cast<sf::Uint8>(c[3][k]));
+            }
+        }
+
+        /**
+         * @brief Exports one sf::Points vertex per live particle.
+         */
+        inline void
+            points(const ParticleSystem& system, sf::VertexArray& out) {
+            const int n = system.size();
+            out.setPrimitiveType(sf::Points);
+            out.resize(n);
+            if (n == 0) return;
+            sf::Vertex* v = &out[0];
+            const float* px = system.stream(ParticleSystem::PX);
+            const float* py = system.stream(ParticleSystem::PY);
+            sf::Color c[SIMD::LANES];
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                colors(system, i, c);
+                const int lanes = n - i < SIMD::LANES ? n - i : SIMD::LANES;
+                for (int k = 0; k < lanes; ++k) {
+                    v[i + k].position = sf::Vector2f(px[i + k], py[i + k]);
+                    v[i + k].color = c[k];
+                }
+            }
+        }
+
+        /**
+         * @brief Exports two sf::Triangles per live particle: an axis-aligned square of
+         *        the particle's size, with texture coordinates covering textureSize.
+         * @param textureSize Size in pixels of the particle texture (0, 0 for untextured).
+         */
+        inline void
+            quads(const ParticleSystem& system, sf::VertexArray& out,
+                  const sf::Vector2f& textureSize = sf::Vector2f(0.f, 0.f)) {
+            const int n = system.size();
+            out.setPrimitiveType(sf::Triangles);
+            const std::size_t vertexCount = static_cast<std::size_t>(n) * 6;
+            out.resize(vertexCount);
+            if (n == 0) return;
+            sf::Vertex* v = &out[0];
+            const float* px = system.stream(ParticleSystem::PX);
+            const float* py = system.stream(ParticleSystem::PY);
+            const float* size = system.stream(ParticleSystem::SIZE);
+            const sf::Vector2f uv[4] = {
+                sf::Vector2f(0.f, 0.f), sf::Vector2f(textureSize.x, 0.f),
+                sf::Vector2f(textureSize.x, textureSize.y), sf::Vector2f(0.f, textureSize.y)
+            };
+            static const int corner[6] = { 0, 1, 2, 0, 2, 3 };
+            sf::Color c[SIMD::LANES];
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                colors(system, i, c);
+                const int lanes = n - i < SIMD::LANES ? n - i : SIMD::LANES;
+                for (int k = 0; k < lanes; ++k) {
+                    const float h = 0.5f * size[i + k];
+                    const sf::Vector2f p[4] = {
+                        sf::Vector2f(px[i + k] - h, py[i + k] - h), sf::Vector2f(px[i + k] + h, py[i + k] - h),
+                        sf::Vector2f(px[i + k] + h, py[i + k] + h), sf::Vector2f(px[i + k] - h, py[i + k] + h)
+                    };
+                    sf::Vertex* q = v + static_cast<std::size_t>(i + k) * 6;
+                    for (int j = 0; j < 6; ++j) {
+                        q[j].position = p[corner[j]];
+                        q[j].color = c[k];
+                        q[j].texCoords = uv[corner[j]];
+                    }
+                }
+            }
+        }
+
+    } // namespace ParticleExport
+} // namespace EU
@@ -0,0 +1,274 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <Core/SIMD.h>
+#include <Vectors/Vector2.h>
+#include <Vectors/Vector3.h>
+#include <Vectors/Vector4.h>
+
+/**
+ * @file ParticleSystem.h
+ * @brief Fixed-capacity particle pool in SoA layout with SIMD update and
+ *        swap-remove compaction.
+ */
+
+namespace EU {
+
+    /**
+     * @struct ParticleEmitter
+     * @brief Spawn parameters for ParticleSystem::emit(). Each value is the center of a
+     *        uniform random range whose half width is given by the matching jitter.
+     */
+    struct
+        ParticleEmitter {
+        CVector3 position;
+        CVector3 positionJitter;
+        CVector3 velocity;
+        CVector3 velocityJitter;
+        float lifetime = 1.f;
+        float lifetimeJitter = 0.f;
+        float size = 1.f;
+        CVector4 startColor = CVector4(1.f, 1.f, 1.f, 1.f);   ///< RGBA in [0, 1] at birth.
+        CVector4 endColor = CVector4(1.f, 1.f, 1.f, 0.f);     ///< RGBA in [0, 1] at death.
+    };
+
+    /**
+     * @class ParticleSystem
+     * @brief Pool of particles stored as one float stream per component.
+     *
+     * Live particles always occupy [0, size()); dead ones are removed by moving the
+     * last live particle into their slot, so the pool never allocates after
+     * construction and every kernel runs over a dense range. Streams are padded to
+     * SIMD::LANES, so update() processes whole registers and the lanes past size()
+     * only ever touch unused capacity.
+     *
+     * The colour is advanced linearly from startColor to endColor over the lifetime
+     * by storing a per-particle colour rate, which keeps the update a single
+     * multiply-add per channel.
+     */
+    class
+        ParticleSystem {
+    public:
+        /**
+         * @brief Index of each float stream.
+         */
+        enum
+            Stream {
+            PX, PY, PZ,                 ///< Position.
+            VX, VY, VZ,                 ///< Velocity.
+            R, G, B, A,                 ///< Colour, RGBA in [0, 1].
+            DR, DG, DB, DA,             ///< Colour change per second.
+            LIFE,                       ///< Remaining lifetime in seconds.
+            SIZE,                       ///< Size in world units.
+            STREAM_COUNT
+        };
+
+        CVector3 gravity;               ///< Constant acceleration applied to every particle.
+        float drag = 0.f;               ///< Fraction of velocity removed per second.
+
+        /**
+         * @brief Creates a pool.
+         * @param capacity Maximum number of live particles.
+         * @param seed Seed of the emitter's random generator.
+         */
+        explicit ParticleSystem(int capacity, std::uint32_t seed = 0x9E3779B9u)
+            : m_capacity(capacity), m_count(0), m_random(seed ? seed : 1u) {
+            const std::size_t padded = static_cast<std::size_t>((capacity + SIMD::LANES - 1) / SIMD::LANES * SIMD::LANES);
+            for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s].assign(padded, 0.f);
+        }
+
+        int
+            size() const {
+            return m_count;
+        }
+
+        int
+            capacity() const {
+            return m_capacity;
+        }
+
+        /**
+         * @brief Kills every particle.
+         */
+        void
+            clear() {
+            m_count = 0;
+        }
+
+        /**
+         * @brief Read-only access to a stream holding size() live particles.
+         */
+        const float*
+            stream(Stream s) const {
+            return m_streams[s].data();
+        }
+
+        CVector3
+            position(int i) const {
+            return CVector3(m_streams[PX][i], m_streams[PY][i], m_streams[PZ][i]);
+        }
+
+        CVector2
+            position2D(int i) const {
+            return CVector2(m_streams[PX][i], m_streams[PY][i]);
+        }
+
+        CVector4
+            color(int i) const {
+            return CVector4(m_streams[R][i], m_streams[G][i], m_streams[B][i], m_streams[A][i]);
+        }
+
+        /**
+         * @brief Spawns a single particle.
+         * @return False if the pool is full.
+         */
+        bool
+            spawn(const CVector3& position, const CVector3& velocity, float lifetime,
+                  const CVector4& startColor, const CVector4& endColor, float size = 1.f) {
+            if (m_count >= m_capacity || lifetime <= 0.f) return false;
+            const int i = m_count++;
+            write(i, position, velocity, lifetime, startColor, endColor, size);
+            return true;
+        }
+
+        /**
+         * @brief 2D convenience overload; z is set to 0.
+         */
+        bool
+            spawn(const CVector2& position, const CVector2& velocity, float lifetime,
+                  const CVector4& startColor, const CVector4& endColor, float size = 1.f) {
+            return spawn(CVector3(position.x, position.y, 0.f), CVector3(velocity.x, velocity.y, 0.f),
+                         lifetime, startColor, endColor, size);
+        }
+
+        /**
+         * @brief Spawns up to count particles from an emitter description.
+         * @return Number of particles actually spawned (limited by the free capacity).
+         */
+        int
+            emit(const ParticleEmitter& emitter, int count) {
+            const int free = m_capacity - m_count;
+            if (count > free) count = free;
+            for (int n = 0; n < count; ++n) {
+                float lifetime = emitter.lifetime + emitter.lifetimeJitter * randomSigned();
+                if (lifetime <= 0.f) lifetime = 1e-3f;
+                CVector3 p(emitter.position.x + emitter.positionJitter.x * randomSigned(),
+                           emitter.position.y + emitter.positionJitter.y * randomSigned(),
+                           emitter.position.z + emitter.positionJitter.z * randomSigned());
+                CVector3 v(emitter.velocity.x + emitter.velocityJitter.x * randomSigned(),
+                           emitter.velocity.y + emitter.velocityJitter.y * randomSigned(),
+                           emitter.velocity.z + emitter.velocityJitter.z * randomSigned());
+                write(m_count++, p, v, lifetime, emitter.startColor, emitter.endColor, emitter.size);
+            }
+            return count;
+        }
+
+        /**
+         * @brief Advances every live particle and removes the ones that died.
+         * @param dt Time step in seconds.
+         */
+        void
+            update(float dt) {
+            using SIMD::float4;
+            const float4 vdt(dt);
+            const float4 gx(gravity.x * dt), gy(gravity.y * dt), gz(gravity.z * dt);
+            const float4 dragScale(1.f / (1.f + dt * drag));
+            const float4 zero = float4::zero(), one(1.f);
+            const int n = (m_count + SIMD::LANES - 1) / SIMD::LANES * SIMD::LANES;
+
+            int deadLanes = 0;
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                const float4 vx = (load(VX, i) + gx) * dragScale;
+                const float4 vy = (load(VY, i) + gy) * dragScale;
+                const float4 vz = (load(VZ, i) + gz) * dragScale;
+                store(VX, i, vx); store(VY, i, vy); store(VZ, i, vz);
+                store(PX, i, madd(vx, vdt, load(PX, i)));
+                store(PY, i, madd(vy, vdt, load(PY, i)));
+                store(PZ, i, madd(vz, vdt, load(PZ, i)));
+                for (int c = 0; c < 4; ++c) {
+                    const Stream channel = static_cast<Stream>(R + c);
+                    const Stream rate = static_cast<Stream>(DR + c);
+                    store(channel, i, SIMD::min(SIMD::max(madd(load(rate, i), vdt, load(channel, i)), zero), one));
+                }
+                const float4 life = load(LIFE, i) - vdt;
+                store(LIFE, i, life);
+                // Lanes past m_count hold stale data and must not trigger compaction.
+                const int live = m_count - i >= SIMD::LANES ? 0xF : (1 << (m_count - i)) - 1;
+                deadLanes |= SIMD::movemask(life <= zero) & live;
+            }
+            if (deadLanes) compact();
+        }
+
+        /**
+         * @brief Removes every particle whose lifetime ran out, moving live particles
+         *        from the end of the pool into the holes. Order is not preserved.
+         */
+        void
+            compact() {
+            using SIMD::float4;
+            const float4 zero = float4::zero();
+            int i = 0;
+            while (i < m_count) {
+                // Skip whole registers without dead particles.
+                if (i % SIMD::LANES == 0 && i + SIMD::LANES <= m_count &&
+                    !SIMD::anyTrue(load(LIFE, i) <= zero)) {
+                    i += SIMD::LANES;
+                    continue;
+                }
+                if (m_streams[LIFE][i] > 0.f) {
+                    ++i;
+                    continue;
+                }
+                const int last = --m_count;
+                if (i != last) {
+                    for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s][i] = m_streams[s][last];
+                }
+                // Stay on i: the particle moved in may be dead too.
+            }
+        }
+
+    private:
+        SIMD::float4
+            load(Stream s, int i) const {
+            return SIMD::float4::loadu(&m_streams[s][i]);
+        }
+
+        void
+            store(Stream s, int i, const SIMD::float4& value) {
+            value.storeu(&m_streams[s][i]);
+        }
+
+        void
+            write(int i, const CVector3& p, const CVector3& v, float lifetime,
+                  const CVector4& startColor, const CVector4& endColor, float size) {
+            const float invLife = 1.f / lifetime;
+            m_streams[PX][i] = p.x; m_streams[PY][i] = p.y; m_streams[PZ][i] = p.z;
+            m_streams[VX][i] = v.x; m_streams[VY][i] = v.y; m_streams[VZ][i] = v.z;
+            m_streams[R][i] = startColor.x; m_streams[DR][i] = (endColor.x - startColor.x) * invLife;
+            m_streams[G][i] = startColor.y; m_streams[DG][i] = (endColor.y - startColor.y) * invLife;
+            m_streams[B][i] = startColor.z; m_streams[DB][i] = (endColor.z - startColor.z) * invLife;
+            m_streams[A][i] = startColor.w; m_streams[DA][i] = (endColor.w - startColor.w) * invLife;
+            m_streams[LIFE][i] = lifetime;
+            m_streams[SIZE][i] = size;
+        }
+
+        /**
+         * @brief Uniform random value in [-1, 1] (xorshift32).
+         */
+        float
+            randomSigned() {
+            m_random ^= m_random << 13;
+            m_random ^= m_random >> 17;
+            m_random ^= m_random << 5;
+            return static_cast<float>(m_random >> 8) * (2.f / 16777216.f) - 1.f;
+        }
+
+        std::vector<float> m_streams[STREAM_COUNT];
+        int m_capacity;
+        int m_count;
+        std::uint32_t m_random;
+    };
+
+} // namespace EU
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <Vectors/Vector3.h>
+#include <Matrices/Matrix3x3.h>
+#include <Rotations/Quaternion.h>
+
+/**
+ * @file ConvexShapes.h
+ * @brief Support-mapping convex shapes consumed by the GJK/EPA narrowphase.
+ *
+ * Every shape exposes the same two members, so the narrowphase is written as
+ * templates and no virtual dispatch happens inside the iteration loops:
+ *  - support(dir): farthest point of the shape's core in world space along dir.
+ *  - margin():     radius added around the core (spheres and capsules are a point
+ *                  and a segment inflated by their radius, polytopes use 0).
+ */
+
+namespace EU {
+
+    /**
+     * @class SphereShape
+     * @brief Sphere; its core is the center point.
+     */
+    class
+        SphereShape {
+    public:
+        CVector3 center;
+        float radius;
+
+        SphereShape() : center(), radius(1.f) {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param center World-space center.
+         * @param radius Sphere radius.
+         */
+        SphereShape(const CVector3& center, float radius) : center(center), radius(radius) {}
+
+        CVector3
+            support(const CVector3&) const {
+            return center;
+        }
+
+        float
+            margin() const {
+            return radius;
+        }
+    };
+
+    /**
+     * @class CapsuleShape
+     * @brief Capsule; its core is the segment between the two cap centers.
+     */
+    class
+        CapsuleShape {
+    public:
+        CVector3 pointA;
+        CVector3 pointB;
+        float radius;
+
+        CapsuleShape() : pointA(0.f, -0.5f, 0.f), pointB(0.f, 0.5f, 0.f), radius(0.5f) {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param pointA First cap center in world space.
+         * @param pointB Second cap center in world space.
+         * @param radius Capsule radius.
+         */
+        CapsuleShape(const CVector3& pointA, const CVector3& pointB, float radius)
+            : pointA(pointA), pointB(pointB), radius(radius) {
+        }
+
+        CVector3
+            support(const CVector3& dir) const {
+            return dir.dot(pointA) >= dir.dot(pointB) ? pointA : pointB;
+        }
+
+        float
+            margin() const {
+            return radius;
+        }
+    };
+
+    /**
+     * @class BoxShape
+     * @brief Oriented box. The rotation is kept as a matrix so support() costs two
+     *        matrix-vector products instead of two quaternion sandwiches.
+     */
+    class
+        BoxShape {
+    public:
+        CVector3 center;
+        CVector3 halfExtents;
+        Matrix3x3 rotation;
+
+        BoxShape() : center(), halfExtents(0.5f, 0.5f, 0.5f), rotation() {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param center World-space center.
+         * @param halfExtents Half size along each local axis.
+         * @param orientation World-space orientation.
+         */
+        BoxShape(const CVector3& center, const CVector3& halfExtents,
+                 const Quaternion& orientation = Quaternion())
+            : center(center), halfExtents(halfExtents), rotation(orientation.toMatrix()) {
+        }
+
+        CVector3
+            support(const CVector3& dir) const {
+            const Matrix3x3& r = rotation;
+            // Local direction = R^T * dir; only its signs matter.
+            float lx = r.m[0][0] * dir.x + r.m[1][0] * dir.y + r.m[2][0] * dir.z;
+            float ly = r.m[0][1] * dir.x + r.m[1][1] * dir.y + r.m[2][1] * dir.z;
+            float lz = r.m[0][2] * dir.x + r.m[1][2] * dir.y + r.m[2][2] * dir.z;
+            CVector3 local(lx >= 0.f ? halfExtents.x : -halfExtents.x,
+                           ly >= 0.f ? halfExtents.y : -halfExtents.y,
+                           lz >= 0.f ? halfExtents.z : -halfExtents.z);
+            return center + r * local;
+        }
+
+        float
+            margin() const {
+            return 0.f;
+        }
+    };
+
+    /**
+     * @class ConvexHullShape
+     * @brief Convex point cloud placed in the world by a position and rotation.
+     *        The points are not owned and must outlive the shape.
+     */
+    class
+        ConvexHullShape {
+    public:
+        const CVector3* points;
+        int count;
+        CVector3 position;
+        Matrix3x3 rotation;
+
+        ConvexHullShape() : points(nullptr), count(0), position(), rotation() {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param points Hull vertices in local space.
+         * @param count Number of vertices.
+         * @param position World-space position.
+         * @param orientation World-space orientation.
+         */
+        ConvexHullShape(const CVector3* points, int count,
+                        const CVector3& position = CVector3(),
+                        const Quaternion& orientation = Quaternion())
+            : points(points), count(count), position(position), rotation(orientation.toMatrix()) {
+        }
+
+        CVector3
+            support(const CVector3& dir) const {
+            const Matrix3x3& r = rotation;
+            CVector3 local(r.m[0][0] * dir.x + r.m[1][0] * dir.y + r.m[2][0] * dir.z,
+                           r.m[0][1] * dir.x + r.m[1][1] * dir.y + r.m[2][1] * dir.z,
+                           r.m[0][2] * dir.x + r.m[1][2] * dir.y + r.m[2][2] * dir.z);
+            int best = 0;
+            float bestDot = local.dot(points[0]);
+            for (int i = 1; i < count; ++i) {
+                float d = local.dot(points[i]);
+                if (d > bestDot) {
+                    bestDot = d;
+                    best = i;
+                }
+            }
+            return position + r * points[best];
+        }
+
+        float
+            margin() const {
+            return 0.f;
+        }
+    };
+
+} // namespace EU
@@ -0,0 +1,319 @@
+#pragma once
+
+#include <utility>
+#include <Physics/GJK.h>
+#include <Vectors/Vector3.h>
+#include <Core/Constants.h>
+#include <Math/EngineMath.h>
+
+/**
+ * @file EPA.h
+ * @brief Expanding Polytope Algorithm for penetration depth, plus the combined
+ *        GJK/EPA contact query used by the narrowphase.
+ */
+
+namespace EU {
+
+    /**
+     * @struct ContactResult
+     * @brief Contact produced by the narrowphase for one convex pair.
+     */
+    struct
+        ContactResult {
+        bool colliding = false;     ///< True if the shapes overlap.
+        float depth = 0.f;          ///< Penetration depth along the normal.
+        CVector3 normal;            ///< Unit direction from A to B; moving B by normal * depth separates the pair.
+        CVector3 pointA;            ///< Deepest point of A inside B.
+        CVector3 pointB;            ///< Deepest point of B inside A.
+        int iterations = 0;         ///< GJK plus EPA iterations performed.
+    };
+
+    /**
+     * @class InflatedShape
+     * @brief Adapter exposing the full (core + margin) support function of a shape.
+     *        EPA needs it because it works on the real surface, not on the core.
+     */
+    template<class Shape>
+    class
+        InflatedShape {
+    public:
+        explicit InflatedShape(const Shape& shape) : shape(shape) {}
+
+        CVector3
+            support(const CVector3& dir) const {
+            CVector3 p = shape.support(dir);
+            float r = shape.margin();
+            if (r > 0.f) {
+                float len = dir.length();
+                if (len > 0.f) p += dir * (r / len);
+            }
+            return p;
+        }
+
+        float
+            margin() const {
+            return 0.f;
+        }
+
+        const Shape& shape;
+    };
+
+    /**
+     * @class EPAPolytope
+     * @brief Fixed-capacity polytope used by EPA; no heap allocation per query.
+     */
+    class
+        EPAPolytope {
+    public:
+        static constexpr int MAX_VERTICES = 64;
+        static constexpr int MAX_FACES = 128;
+        static constexpr int MAX_EDGES = 96;
+
+        struct
+            Face {
+            int i[3];
+            CVector3 normal;
+            float distance;
+        };
+
+        SimplexVertex vertices[MAX_VERTICES];
+        Face faces[MAX_FACES];
+        int vertexCount = 0;
+        int faceCount = 0;
+
+        /**
+         * @brief Adds an outward-facing triangle. Returns false on capacity or degeneracy.
+         */
+        bool
+            addFace(int a, int b, int c) {
+            if (faceCount >= MAX_FACES) return false;
+            CVector3 n = (vertices[b].w - vertices[a].w).cross(vertices[c].w - vertices[a].w);
+            float len = n.length();
+            if (len < Constants::EPSILON * Constants::EPSILON) return false;
+            Face& f = faces[faceCount++];
+            f.i[0] = a; f.i[1] = b; f.i[2] = c;
+            f.normal = n / len;
+            f.distance = f.normal.dot(vertices[a].w);
+            return true;
+        }
+
+        /**
+         * @brief Index of the face closest to the origin.
+         */
+        int
+            closestFace() const {
+            int best = 0;
+            for (int f = 1; f < faceCount; ++f) {
+                if (faces[f].distance < faces[best].distance) best = f;
+            }
+            return best;
+        }
+
+        /**
+         * @brief Removes every face visible from w and stitches the horizon to the new vertex.
+         * @return False if the polytope ran out of capacity or became degenerate.
+         */
+        bool
+            expand(const SimplexVertex& w) {
+            if (vertexCount >= MAX_VERTICES) return false;
+            const int wi = vertexCount;
+            vertices[vertexCount++] = w;
+
+            int edges[MAX_EDGES][2];
+            int edgeCount = 0;
+            for (int f = 0; f < faceCount; ) {
+                Face& face = faces[f];
+                if (face.normal.dot(w.w - vertices[face.i[0]].w) <= 0.f) {
+                    ++f;
+                    continue;
+                }
+                for (int e = 0; e < 3; ++e) {
+                    int a = face.i[e], b = face.i[(e + 1) % 3];
+                    // An edge shared by two visible faces is interior; drop both copies.
+                    bool shared = false;
+                    for (int k = 0; k < edgeCount; ++k) {
+                        if (edges[k][0] == b && edges[k][1] == a) {
+                            edges[k][0] = edges[edgeCount - 1][0];
+                            edges[k][1] = edges[edgeCount - 1][1];
+                            --edgeCount;
+                            shared = true;
+                            break;
+                        }
+                    }
+                    if (!shared) {
+                        if (edgeCount >= MAX_EDGES) return false;
+                        edges[edgeCount][0] = a;
+                        edges[edgeCount][1] = b;
+                        ++edgeCount;
+                    }
+                }
+                faces[f] = faces[--faceCount];
+            }
+
+            for (int e = 0; e < edgeCount; ++e) {
+                if (!addFace(edges[e][0], edges[e][1], wi)) return false;
+            }
+            return faceCount > 0;
+        }
+    };
+
+    /**
+     * @brief Grows a GJK simplex that touches the origin into a tetrahedron so EPA can start.
+     * @return False if the Minkowski difference is flat (touching contact, zero depth).
+     */
+    template<class ShapeA, class ShapeB>
+    inline
+        bool epaBlowUpSimplex(const ShapeA& shapeA, const ShapeB& shapeB, Simplex& simplex) {
+        static const CVector3 axes[6] = {
+            CVector3(1.f, 0.f, 0.f), CVector3(-1.f, 0.f, 0.f),
+            CVector3(0.f, 1.f, 0.f), CVector3(0.f, -1.f, 0.f),
+            CVector3(0.f, 0.f, 1.f), CVector3(0.f, 0.f, -1.f)
+        };
+        const float eps = Constants::EPSILON;
+
+        if (simplex.count == 1) {
+            for (int i = 0; i < 6 && simplex.count == 1; ++i) {
+                SimplexVertex s = minkowskiSupport(shapeA, shapeB, axes[i]);
+                if ((s.w - simplex.v[0].w).lengthSquared() > eps) simplex.add(s);
+            }
+        }
+        if (simplex.count == 2) {
+            CVector3 d = simplex.v[1].w - simplex.v[0].w;
+            CVector3 axis = Math::abs(d.x) < Math::abs(d.y) ? CVector3(1.f, 0.f, 0.f) : CVector3(0.f, 1.f, 0.f);
+            CVector3 perp = d.cross(axis);
+            for (int i = 0; i < 2 && simplex.count == 2; ++i) {
+                SimplexVertex s = minkowskiSupport(shapeA, shapeB, i == 0 ? perp : perp * -1.f);
+                if (d.cross(s.w - simplex.v[0].w).lengthSquared() > eps) simplex.add(s);
+            }
+        }
+        if (simplex.count == 3) {
+            CVector3 n = (simplex.v[1].w - simplex.v[0].w).cross(simplex.v[2].w - simplex.v[0].w);
+            for (int i = 0; i < 2 && simplex.count == 3; ++i) {
+                SimplexVertex s = minkowskiSupport(shapeA, shapeB, i == 0 ? n : n * -1.f);
+                if (Math::abs(n.dot(s.w - simplex.v[0].w)) > eps) simplex.add(s);
+            }
+        }
+        return simplex.count == 4;
+    }
+
+    /**
+     * @brief Expanding Polytope Algorithm on the (full) shapes, starting from a GJK
+     *        tetrahedron that encloses the origin.
+     * @param shapeA First shape (margin must already be part of its support).
+     * @param shapeB Second shape.
+     * @param simplex Tetrahedron from GJK.
+     * @param contact Output contact; colliding is set by the caller.
+     * @param maxIterations Iteration cap.
+     * @return False if the polytope could not be built.
+     */
+    template<class ShapeA, class ShapeB>
+    inline
+        bool epa(const ShapeA& shapeA, const ShapeB& shapeB, const Simplex& simplex,
+                 ContactResult& contact, int maxIterations = 64) {
+        EPAPolytope poly;
+        for (int i = 0; i < 4; ++i) poly.vertices[poly.vertexCount++] = simplex.v[i];
+
+        // Orient the initial tetrahedron's faces outward.
+        CVector3 n = (poly.vertices[1].w - poly.vertices[0].w).cross(poly.vertices[2].w - poly.vertices[0].w);
+        if (n.dot(poly.vertices[3].w - poly.vertices[0].w) > 0.f) std::swap(poly.vertices[1], poly.vertices[2]);
+        if (!poly.addFace(0, 1, 2) || !poly.addFace(0, 3, 1) ||
+            !poly.addFace(0, 2, 3) || !poly.addFace(1, 3, 2)) {
+            return false;
+        }
+
+        const float tolerance = 1e-4f;
+        EPAPolytope::Face face = poly.faces[poly.closestFace()];
+        SimplexVertex a = poly.vertices[face.i[0]];
+        SimplexVertex b = poly.vertices[face.i[1]];
+        SimplexVertex c = poly.vertices[face.i[2]];
+        for (int it = 0; it < maxIterations; ++it) {
+            ++contact.iterations;
+            SimplexVertex s = minkowskiSupport(shapeA, shapeB, face.normal);
+            if (s.w.dot(face.normal) - face.distance < tolerance) break;
+
+            // On capacity or degeneracy keep the last valid closest face.
+            if (!poly.expand(s)) break;
+            face = poly.faces[poly.closestFace()];
+            a = poly.vertices[face.i[0]];
+            b = poly.vertices[face.i[1]];
+            c = poly.vertices[face.i[2]];
+        }
+
+        // Barycentric coordinates of the origin's projection onto the closest face.
+        CVector3 p = face.normal * face.distance;
+        CVector3 v0 = b.w - a.w, v1 = c.w - a.w, v2 = p - a.w;
+        float d00 = v0.dot(v0), d01 = v0.dot(v1), d11 = v1.dot(v1);
+        float d20 = v2.dot(v0), d21 = v2.dot(v1);
+        float denom = d00 * d11 - d01 * d01;
+        float lb = 0.f, lc = 0.f;
+        if (Math::abs(denom) > 0.f) {
+            lb = (d11 * d20 - d01 * d21) / denom;
+            lc = (d00 * d21 - d01 * d20) / denom;
+        }
+        float la = 1.f - lb - lc;
+
+        // The face normal of A - B points from A towards B.
+        contact.normal = face.normal;
+        contact.depth = face.distance;
+        contact.pointA = a.a * la + b.a * lb + c.a * lc;
+        contact.pointB = a.b * la + b.b * lb + c.b * lc;
+        return true;
+    }
+
+    /**
+     * @brief Full narrowphase for a convex pair: GJK first, then either the margin
+     *        contact (shallow) or EPA (deep).
+     * @param shapeA First shape.
+     * @param shapeB Second shape.
+     * @param cache Optional GJK warm-start cache for this pair.
+     * @return Contact information; colliding is false when the shapes are apart or
+     *         when EPA could not build a contact normal.
+     */
+    template<class ShapeA, class ShapeB>
+    inline
+        ContactResult collide(const ShapeA& shapeA, const ShapeB& shapeB, GJKCache* cache = nullptr) {
+        ContactResult contact;
+        Simplex simplex;
+        int iterations = 0;
+        const float margins = shapeA.margin() + shapeB.margin();
+
+        if (!gjkCore(shapeA, shapeB, simplex, cache, 32, iterations)) {
+            contact.iterations = iterations;
+            CVector3 pa, pb;
+            simplex.witnessPoints(pa, pb);
+            CVector3 delta = pb - pa;
+            float coreDistance = delta.length();
+            if (coreDistance >= margins) return contact;
+
+            // Shallow contact: the cores are apart, only the margins overlap.
+            if (coreDistance > Constants::EPSILON) {
+                contact.colliding = true;
+                contact.normal = delta / coreDistance;
+                contact.depth = margins - coreDistance;
+                contact.pointA = pa + contact.normal * shapeA.margin();
+                contact.pointB = pb - contact.normal * shapeB.margin();
+                return contact;
+            }
+        }
+        contact.iterations = iterations;
+
+        // Deep contact: the cores overlap, so redo GJK on the inflated shapes (seeded
+        // with the core simplex directions) to get a tetrahedron around the origin.
+        InflatedShape<ShapeA> fullA(shapeA);
+        InflatedShape<ShapeB> fullB(shapeB);
+        GJKCache seed;
+        seed.count = simplex.count;
+        for (int i = 0; i < simplex.count; ++i) seed.directions[i] = simplex.v[i].dir;
+
+        Simplex start;
+        int extra = 0;
+        bool overlap = gjkCore(fullA, fullB, start, &seed, 32, extra);
+        contact.iterations += extra;
+        if (!overlap) return contact;
+        if (start.count < 4 && !epaBlowUpSimplex(fullA, fullB, start)) return contact;
+
+        contact.colliding = epa(fullA, fullB, start, contact);
+        return contact;
+    }
+
+} // namespace EU
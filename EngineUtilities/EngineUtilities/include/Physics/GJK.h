@@ -0,0 +1,389 @@
+#pragma once
+
+#include <Vectors/Vector3.h>
+#include <Core/Constants.h>
+#include <Math/EngineMath.h>
+
+/**
+ * @file GJK.h
+ * @brief Gilbert-Johnson-Keerthi distance and overlap queries between two
+ *        support-mapping shapes (see Physics/ConvexShapes.h).
+ *
+ * The query runs on the shape cores and accounts for margins afterwards, which
+ * keeps spheres and capsules exact and fast. A GJKCache stores the search
+ * directions of the final simplex; feeding it back next frame rebuilds an almost
+ * converged simplex, so coherent pairs usually finish in one or two iterations.
+ */
+
+namespace EU {
+
+    /**
+     * @struct GJKCache
+     * @brief Warm-start data for one shape pair. Keep one per persistent pair.
+     */
+    struct
+        GJKCache {
+        CVector3 directions[4];
+        int count = 0;
+
+        /**
+         * @brief Drops the cached simplex (e.g. after a teleport).
+         */
+        void
+            reset() {
+            count = 0;
+        }
+    };
+
+    /**
+     * @struct GJKResult
+     * @brief Outcome of a distance query.
+     */
+    struct
+        GJKResult {
+        bool overlapping = false;   ///< True if the shapes (including margins) touch or overlap.
+        float distance = 0.f;       ///< Separation distance, 0 when overlapping.
+        CVector3 pointA;            ///< Closest point on A (valid when separated).
+        CVector3 pointB;            ///< Closest point on B (valid when separated).
+        CVector3 normal;            ///< Unit direction from A to B (valid when separated).
+        int iterations = 0;         ///< GJK iterations performed.
+    };
+
+    /**
+     * @struct SimplexVertex
+     * @brief Minkowski difference vertex w = a - b together with its sources.
+     */
+    struct
+        SimplexVertex {
+        CVector3 w;
+        CVector3 a;
+        CVector3 b;
+        CVector3 dir;
+    };
+
+    /**
+     * @class Simplex
+     * @brief Up to four Minkowski vertices plus the closest-point solver that reduces
+     *        them to the smallest sub-simplex supporting the point closest to the origin.
+     */
+    class
+        Simplex {
+    public:
+        SimplexVertex v[4];
+        float lambda[4];
+        int count = 0;
+
+        void
+            add(const SimplexVertex& vertex) {
+            v[count] = vertex;
+            lambda[count] = 0.f;
+            ++count;
+        }
+
+        /**
+         * @brief Returns the point of the simplex closest to the origin (weighted by lambda).
+         */
+        CVector3
+            closest() const {
+            if (count == 3) {
+                // Face region: projecting the origin on the plane is far more accurate
+                // than the barycentric sum when the origin is close to the face.
+                CVector3 n = (v[1].w - v[0].w).cross(v[2].w - v[0].w);
+                float nn = n.lengthSquared();
+                if (nn > 0.f) return n * (v[0].w.dot(n) / nn);
+            }
+            CVector3 p;
+            for (int i = 0; i < count; ++i) p += v[i].w * lambda[i];
+            return p;
+        }
+
+        /**
+         * @brief Computes the witness points on both shapes from the barycentric weights.
+         */
+        void
+            witnessPoints(CVector3& pa, CVector3& pb) const {
+            pa = CVector3();
+            pb = CVector3();
+            for (int i = 0; i < count; ++i) {
+                pa += v[i].a * lambda[i];
+                pb += v[i].b * lambda[i];
+            }
+        }
+
+        /**
+         * @brief Reduces the simplex towards the origin.
+         * @return False if the origin is enclosed by a tetrahedron (overlap).
+         */
+        bool
+            solve() {
+            switch (count) {
+            case 1: lambda[0] = 1.f; return true;
+            case 2: solveSegment(0, 1); return true;
+            case 3: solveTriangle(0, 1, 2); return true;
+            default: return solveTetrahedron();
+            }
+        }
+
+    private:
+        void
+            keep(int i0, float l0) {
+            SimplexVertex a = v[i0];
+            v[0] = a; lambda[0] = l0;
+            count = 1;
+        }
+
+        void
+            keep(int i0, float l0, int i1, float l1) {
+            SimplexVertex a = v[i0], b = v[i1];
+            v[0] = a; lambda[0] = l0;
+            v[1] = b; lambda[1] = l1;
+            count = 2;
+        }
+
+        void
+            keep(int i0, float l0, int i1, float l1, int i2, float l2) {
+            SimplexVertex a = v[i0], b = v[i1], c = v[i2];
+            v[0] = a; lambda[0] = l0;
+            v[1] = b; lambda[1] = l1;
+            v[2] = c; lambda[2] = l2;
+            count = 3;
+        }
+
+        void
+            solveSegment(int ia, int ib) {
+            const CVector3& a = v[ia].w;
+            CVector3 ab = v[ib].w - a;
+            float denom = ab.dot(ab);
+            float t = denom > 0.f ? -a.dot(ab) / denom : 0.f;
+            if (t <= 0.f) keep(ia, 1.f);
+            else if (t >= 1.f) keep(ib, 1.f);
+            else keep(ia, 1.f - t, ib, t);
+        }
+
+        /**
+         * @brief Closest point on triangle to the origin by Voronoi regions (Ericson 5.1.5).
+         */
+        void
+            solveTriangle(int ia, int ib, int ic) {
+            const CVector3& a = v[ia].w;
+            const CVector3& b = v[ib].w;
+            const CVector3& c = v[ic].w;
+            CVector3 ab = b - a, ac = c - a;
+
+            float d1 = -ab.dot(a), d2 = -ac.dot(a);
+            if (d1 <= 0.f && d2 <= 0.f) { keep(ia, 1.f); return; }
+
+            float d3 = -ab.dot(b), d4 = -ac.dot(b);
+            if (d3 >= 0.f && d4 <= d3) { keep(ib, 1.f); return; }
+
+            float vc = d1 * d4 - d3 * d2;
+            if (vc <= 0.f && d1 >= 0.f && d3 <= 0.f) {
+                float t = d1 / (d1 - d3);
+                keep(ia, 1.f - t, ib, t);
+                return;
+            }
+
+            float d5 = -ab.dot(c), d6 = -ac.dot(c);
+            if (d6 >= 0.f && d5 <= d6) { keep(ic, 1.f); return; }
+
+            float vb = d5 * d2 - d1 * d6;
+            if (vb <= 0.f && d2 >= 0.f && d6 <= 0.f) {
+                float t = d2 / (d2 - d6);
+                keep(ia, 1.f - t, ic, t);
+                return;
+            }
+
+            float va = d3 * d6 - d5 * d4;
+            if (va <= 0.f && (d4 - d3) >= 0.f && (d5 - d6) >= 0.f) {
+                float t = (d4 - d3) / ((d4 - d3) + (d5 - d6));
+                keep(ib, 1.f - t, ic, t);
+                return;
+            }
+
+            float denom = 1.f / (va + vb + vc);
+            float lv = vb * denom, lw = vc * denom;
+            keep(ia, 1.f - lv - lw, ib, lv, ic, lw);
+        }
+
+        /**
+         * @brief True if the origin and d lie on opposite sides of plane (a, b, c).
+         */
+        static
+            bool originOutside(const CVector3& a, const CVector3& b, const CVector3& c, const CVector3& d) {
+            CVector3 n = (b - a).cross(c - a);
+            float signOrigin = -a.dot(n);
+            float signD = (d - a).dot(n);
+            // d (nearly) lies in the face plane, e.g. coplanar support points of two
+            // touching faces: the orientation is noise, so let the face be examined.
+            if (signD * signD <= 1e-10f * (d - a).lengthSquared() * n.lengthSquared()) return true;
+            return signOrigin * signD < 0.f;
+        }
+
+        bool
+            solveTetrahedron() {
+            static const int faces[4][4] = {
+                { 0, 1, 2, 3 }, { 0, 2, 3, 1 }, { 0, 3, 1, 2 }, { 1, 3, 2, 0 }
+            };
+
+            Simplex best;
+            float bestDistSq = Constants::INF;
+            bool outside = false;
+            for (int f = 0; f < 4; ++f) {
+                const int* i = faces[f];
+                if (!originOutside(v[i[0]].w, v[i[1]].w, v[i[2]].w, v[i[3]].w)) continue;
+                outside = true;
+
+                Simplex face;
+                face.add(v[i[0]]);
+                face.add(v[i[1]]);
+                face.add(v[i[2]]);
+                face.solveTriangle(0, 1, 2);
+                float distSq = face.closest().lengthSquared();
+                if (distSq < bestDistSq) {
+                    bestDistSq = distSq;
+                    best = face;
+                }
+            }
+
+            if (!outside) {
+                lambda[0] = lambda[1] = lambda[2] = lambda[3] = 0.25f;
+                return false;
+            }
+            *this = best;
+            return true;
+        }
+    };
+
+    /**
+     * @brief Support point of the Minkowski difference core(A) - core(B) along dir.
+     */
+    template<class ShapeA, class ShapeB>
+    inline
+        SimplexVertex minkowskiSupport(const ShapeA& shapeA, const ShapeB& shapeB, const CVector3& dir) {
+        SimplexVertex s;
+        s.dir = dir;
+        s.a = shapeA.support(dir);
+        s.b = shapeB.support(dir * -1.f);
+        s.w = s.a - s.b;
+        return s;
+    }
+
+    /**
+     * @brief Runs GJK on the shape cores and leaves the final simplex in 'simplex'.
+     * @return True if the cores overlap. Otherwise 'simplex' holds the closest feature.
+     */
+    template<class ShapeA, class ShapeB>
+    inline
+        bool gjkCore(const ShapeA& shapeA, const ShapeB& shapeB, Simplex& simplex,
+                     GJKCache* cache, int maxIterations, int& iterations) {
+        simplex.count = 0;
+        iterations = 0;
+
+        // Warm start: re-evaluate last frame's directions against the current poses.
+        if (cache) {
+            for (int i = 0; i < cache->count; ++i) {
+                SimplexVertex s = minkowskiSupport(shapeA, shapeB, cache->directions[i]);
+                bool duplicate = false;
+                for (int j = 0; j < simplex.count; ++j) {
+                    if ((simplex.v[j].w - s.w).lengthSquared() < Constants::EPSILON) duplicate = true;
+                }
+                if (!duplicate) simplex.add(s);
+            }
+        }
+        if (simplex.count == 0) {
+            CVector3 dir = shapeB.support(CVector3(1.f, 0.f, 0.f)) - shapeA.support(CVector3(1.f, 0.f, 0.f));
+            if (dir.lengthSquared() < Constants::EPSILON) dir = CVector3(1.f, 0.f, 0.f);
+            simplex.add(minkowskiSupport(shapeA, shapeB, dir));
+        }
+
+        bool overlap = !simplex.solve();
+        const float relTolerance = 1e-4f;
+        while (!overlap && iterations < maxIterations) {
+            ++iterations;
+            CVector3 v = simplex.closest();
+            float vv = v.lengthSquared();
+            if (vv < Constants::EPSILON * Constants::EPSILON) {
+                overlap = true;
+                break;
+            }
+
+            SimplexVertex s = minkowskiSupport(shapeA, shapeB, v * -1.f);
+            // No meaningful progress towards the origin: v is the closest point. The
+            // second term absorbs float noise in v.w when v is tiny next to w.
+            float noise = 1e-6f * Math::sqrt(vv * s.w.lengthSquared());
+            if (vv - v.dot(s.w) <= relTolerance * vv + noise) break;
+
+            bool duplicate = false;
+            for (int j = 0; j < simplex.count; ++j) {
+                if ((simplex.v[j].w - s.w).lengthSquared() < Constants::EPSILON * Constants::EPSILON) duplicate = true;
+            }
+            if (duplicate) break;
+
+            Simplex previous = simplex;
+            simplex.add(s);
+            overlap = !simplex.solve();
+
+            // Guard against cycling near contact: every step must move closer to the origin.
+            if (!overlap && simplex.closest().lengthSquared() >= vv) {
+                simplex = previous;
+                break;
+            }
+        }
+
+        if (cache) {
+            cache->count = simplex.count;
+            for (int i = 0; i < simplex.count; ++i) cache->directions[i] = simplex.v[i].dir;
+        }
+        return overlap;
+    }
+
+    /**
+     * @brief Computes the separation between two convex shapes.
+     * @param shapeA First shape.
+     * @param shapeB Second shape.
+     * @param cache Optional warm-start cache for this pair (read and updated).
+     * @param maxIterations Iteration cap.
+     * @return Distance, closest points and separating normal when apart.
+     */
+    template<class ShapeA, class ShapeB>
+    inline
+        GJKResult gjkDistance(const ShapeA& shapeA, const ShapeB& shapeB,
+                              GJKCache* cache = nullptr, int maxIterations = 32) {
+        GJKResult result;
+        Simplex simplex;
+        if (gjkCore(shapeA, shapeB, simplex, cache, maxIterations, result.iterations)) {
+            result.overlapping = true;
+            return result;
+        }
+
+        CVector3 pa, pb;
+        simplex.witnessPoints(pa, pb);
+        CVector3 delta = pb - pa;
+        float coreDistance = delta.length();
+        float margins = shapeA.margin() + shapeB.margin();
+        if (coreDistance <= margins || coreDistance < Constants::EPSILON) {
+            result.overlapping = true;
+            return result;
+        }
+
+        result.normal = delta / coreDistance;
+        result.distance = coreDistance - margins;
+        result.pointA = pa + result.normal * shapeA.margin();
+        result.pointB = pb - result.normal * shapeB.margin();
+        return result;
+    }
+
+    /**
+     * @brief Boolean overlap test between two convex shapes.
+     * @param shapeA First shape.
+     * @param shapeB Second shape.
+     * @param cache Optional warm-start cache for this pair.
+     * @return True if the shapes touch or overlap.
+     */
+    template<class ShapeA, class ShapeB>
+    inline
+        bool gjkOverlap(const ShapeA& shapeA, const ShapeB& shapeB, GJKCache* cache = nullptr) {
+        return gjkDistance(shapeA, shapeB, cache).overlapping;
+    }
+
+} // namespace EU
@@ -0,0 +1,410 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <Core/SIMD.h>
+#include <Vectors/Vector3.h>
+#include <Matrices/Matrix3x3.h>
+#include <Rotations/Quaternion.h>
+
+/**
+ * @file RigidBodySet.h
+ * @brief Rigid-body state stored as structure of arrays, integrated four bodies at a
+ *        time with semi-implicit Euler.
+ */
+
+namespace EU {
+
+    /**
+     * @class RigidBodySet
+     * @brief Owns the dynamic state of many rigid bodies, one float stream per component.
+     *
+     * Bodies are addressed by index. Every stream is padded to a multiple of
+     * SIMD::LANES with inert bodies (identity orientation, zero velocity, infinite
+     * mass), so the kernels never need a scalar tail loop.
+     *
+     * A step is split the usual way so a constraint solver can run in between:
+     *  1. integrateVelocities(): v += (g + F/m) dt, w += I^-1 T dt, then forces are cleared.
+     *  2. (solve contacts / joints on the velocities)
+     *  3. integratePositions(): x += v dt, q += 0.5 (w, 0) q dt, q renormalized.
+     */
+    class
+        RigidBodySet {
+    public:
+        /**
+         * @brief Index of each float stream.
+         */
+        enum
+            Stream {
+            PX, PY, PZ,                 ///< Position.
+            QX, QY, QZ, QW,             ///< Orientation.
+            VX, VY, VZ,                 ///< Linear velocity.
+            WX, WY, WZ,                 ///< Angular velocity (world space).
+            INV_MASS,                   ///< Inverse mass, 0 for static bodies.
+            I00, I01, I02,              ///< Inverse inertia tensor in body space, row major.
+            I10, I11, I12,
+            I20, I21, I22,
+            FX, FY, FZ,                 ///< Accumulated force.
+            TX, TY, TZ,                 ///< Accumulated torque.
+            STREAM_COUNT
+        };
+
+        float linearDamping = 0.f;      ///< Fraction of linear velocity removed per second.
+        float angularDamping = 0.f;     ///< Fraction of angular velocity removed per second.
+
+        RigidBodySet() : m_count(0) {}
+
+        /**
+         * @brief Reserves room for the given number of bodies.
+         */
+        void
+            reserve(int count) {
+            const std::size_t padded = paddedSize(count);
+            for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s].reserve(padded);
+        }
+
+        /**
+         * @brief Removes every body.
+         */
+        void
+            clear() {
+            for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s].clear();
+            m_count = 0;
+        }
+
+        /**
+         * @brief Number of bodies (without padding).
+         */
+        int
+            size() const {
+            return m_count;
+        }
+
+        /**
+         * @brief Adds a body.
+         * @param position World-space position of the center of mass.
+         * @param orientation World-space orientation.
+         * @param inverseMass Inverse mass; 0 makes the body static.
+         * @param inverseInertia Inverse inertia tensor in body space.
+         * @return Index of the new body.
+         */
+        int
+            add(const CVector3& position, const Quaternion& orientation,
+                float inverseMass, const Matrix3x3& inverseInertia) {
+            if (m_count % SIMD::LANES == 0) {
+                for (int i = 0; i < SIMD::LANES; ++i) pushInert();
+            }
+            const int index = m_count++;
+            setPosition(index, position);
+            setOrientation(index, orientation);
+            setInverseMass(index, inverseMass, inverseInertia);
+            return index;
+        }
+
+        /**
+         * @brief Removes a body by moving the last body into its slot.
+         * @param index Body to remove; the body previously at size() - 1 now uses this index.
+         */
+        void
+            remove(int index) {
+            const int last = m_count - 1;
+            for (int s = 0; s < STREAM_COUNT; ++s) {
+                m_streams[s][index] = m_streams[s][last];
+            }
+            resetInert(last);
+            --m_count;
+            if (m_count % SIMD::LANES == 0) {
+                for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s].resize(paddedSize(m_count));
+            }
+        }
+
+        // Per-body access
+
+        CVector3
+            position(int i) const {
+            return get3(PX, i);
+        }
+
+        void
+            setPosition(int i, const CVector3& p) {
+            set3(PX, i, p);
+        }
+
+        Quaternion
+            orientation(int i) const {
+            return Quaternion(m_streams[QX][i], m_streams[QY][i], m_streams[QZ][i], m_streams[QW][i]);
+        }
+
+        void
+            setOrientation(int i, const Quaternion& q) {
+            m_streams[QX][i] = q.x;
+            m_streams[QY][i] = q.y;
+            m_streams[QZ][i] = q.z;
+            m_streams[QW][i] = q.w;
+        }
+
+        CVector3
+            linearVelocity(int i) const {
+            return get3(VX, i);
+        }
+
+        void
+            setLinearVelocity(int i, const CVector3& v) {
+            set3(VX, i, v);
+        }
+
+        CVector3
+            angularVelocity(int i) const {
+            return get3(WX, i);
+        }
+
+        void
+            setAngularVelocity(int i, const CVector3& w) {
+            set3(WX, i, w);
+        }
+
+        float
+            inverseMass(int i) const {
+            return m_streams[INV_MASS][i];
+        }
+
+        /**
+         * @brief Returns the body-space inverse inertia tensor.
+         */
+        Matrix3x3
+            inverseInertia(int i) const {
+            return Matrix3x3(m_streams[I00][i], m_streams[I01][i], m_streams[I02][i],
+                             m_streams[I10][i], m_streams[I11][i], m_streams[I12][i],
+                             m_streams[I20][i], m_streams[I21][i], m_streams[I22][i]);
+        }
+
+        /**
+         * @brief Sets the mass properties of a body.
+         * @param inverseMass Inverse mass; 0 makes the body static.
+         * @param inverseInertia Inverse inertia tensor in body space.
+         */
+        void
+            setInverseMass(int i, float inverseMass, const Matrix3x3& inverseInertia) {
+            m_streams[INV_MASS][i] = inverseMass;
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 3; ++c) {
+                    m_streams[I00 + r * 3 + c][i] = inverseInertia.m[r][c];
+                }
+            }
+        }
+
+        /**
+         * @brief Accumulates a force through the center of mass for the next step.
+         */
+        void
+            applyForce(int i, const CVector3& force) {
+            add3(FX, i, force);
+        }
+
+        /**
+         * @brief Accumulates a torque for the next step.
+         */
+        void
+            applyTorque(int i, const CVector3& torque) {
+            add3(TX, i, torque);
+        }
+
+        /**
+         * @brief Accumulates a force applied at a world-space point.
+         */
+        void
+            applyForceAtPoint(int i, const CVector3& force, const CVector3& point) {
+            add3(FX, i, force);
+            add3(TX, i, (point - position(i)).cross(force));
+        }
+
+        /**
+         * @brief Raw stream access for solvers and other batched kernels.
+         *        Streams hold paddedSize() floats.
+         */
+        float*
+            stream(Stream s) {
+            return m_streams[s].data();
+        }
+
+        const float*
+            stream(Stream s) const {
+            return m_streams[s].data();
+        }
+
+        /**
+         * @brief Number of floats in each stream (size() rounded up to SIMD::LANES).
+         */
+        int
+            paddedSize() const {
+            return static_cast<int>(m_streams[PX].size());
+        }
+
+        // Kernels
+
+        /**
+         * @brief Applies gravity, accumulated forces and torques, and damping to the
+         *        velocities, then clears the accumulators.
+         * @param dt Time step in seconds.
+         * @param gravity Gravity acceleration (ignored by static bodies).
+         */
+        void
+            integrateVelocities(float dt, const CVector3& gravity) {
+            using SIMD::float4;
+            const float4 vdt(dt);
+            const float4 gx(gravity.x), gy(gravity.y), gz(gravity.z);
+            const float4 zero = float4::zero();
+            const float4 linScale(1.f / (1.f + dt * linearDamping));
+            const float4 angScale(1.f / (1.f + dt * angularDamping));
+            const int n = paddedSize();
+
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                const float4 invMass = load(INV_MASS, i);
+                const float4 dynamic = invMass > zero;
+
+                // Linear: v += (g + F/m) dt, static bodies keep their velocity.
+                float4 ax = select(dynamic, gx, zero) + load(FX, i) * invMass;
+                float4 ay = select(dynamic, gy, zero) + load(FY, i) * invMass;
+                float4 az = select(dynamic, gz, zero) + load(FZ, i) * invMass;
+                store(VX, i, madd(ax, vdt, load(VX, i)) * linScale);
+                store(VY, i, madd(ay, vdt, load(VY, i)) * linScale);
+                store(VZ, i, madd(az, vdt, load(VZ, i)) * linScale);
+
+                // Angular: w += R I^-1 R^T T dt with R built from the orientation.
+                float4 r[9];
+                rotationMatrix(load(QX, i), load(QY, i), load(QZ, i), load(QW, i), r);
+                const float4 tx = load(TX, i), ty = load(TY, i), tz = load(TZ, i);
+                const float4 lx = madd(r[0], tx, madd(r[3], ty, r[6] * tz));
+                const float4 ly = madd(r[1], tx, madd(r[4], ty, r[7] * tz));
+                const float4 lz = madd(r[2], tx, madd(r[5], ty, r[8] * tz));
+                const float4 jx = madd(load(I00, i), lx, madd(load(I01, i), ly, load(I02, i) * lz));
+                const float4 jy = madd(load(I10, i), lx, madd(load(I11, i), ly, load(I12, i) * lz));
+                const float4 jz = madd(load(I20, i), lx, madd(load(I21, i), ly, load(I22, i) * lz));
+                const float4 alphaX = madd(r[0], jx, madd(r[1], jy, r[2] * jz));
+                const float4 alphaY = madd(r[3], jx, madd(r[4], jy, r[5] * jz));
+                const float4 alphaZ = madd(r[6], jx, madd(r[7], jy, r[8] * jz));
+                store(WX, i, madd(alphaX, vdt, load(WX, i)) * angScale);
+                store(WY, i, madd(alphaY, vdt, load(WY, i)) * angScale);
+                store(WZ, i, madd(alphaZ, vdt, load(WZ, i)) * angScale);
+
+                for (int s = FX; s <= TZ; ++s) SIMD::float4::zero().storeu(&m_streams[s][i]);
+            }
+        }
+
+        /**
+         * @brief Advances positions and orientations with the current velocities.
+         *        The orientation follows dq/dt = 0.5 (w, 0) q and is renormalized.
+         * @param dt Time step in seconds.
+         */
+        void
+            integratePositions(float dt) {
+            using SIMD::float4;
+            const float4 vdt(dt);
+            const float4 halfDt(0.5f * dt);
+            const int n = paddedSize();
+
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                store(PX, i, madd(load(VX, i), vdt, load(PX, i)));
+                store(PY, i, madd(load(VY, i), vdt, load(PY, i)));
+                store(PZ, i, madd(load(VZ, i), vdt, load(PZ, i)));
+
+                const float4 wx = load(WX, i) * halfDt;
+                const float4 wy = load(WY, i) * halfDt;
+                const float4 wz = load(WZ, i) * halfDt;
+                const float4 qx = load(QX, i), qy = load(QY, i), qz = load(QZ, i), qw = load(QW, i);
+
+                float4 nx = qx + (wx * qw + wy * qz - wz * qy);
+                float4 ny = qy + (wy * qw + wz * qx - wx * qz);
+                float4 nz = qz + (wz * qw + wx * qy - wy * qx);
+                float4 nw = qw - (wx * qx + wy * qy + wz * qz);
+
+                const float4 invLen = float4(1.f) / SIMD::sqrt(madd(nx, nx, madd(ny, ny, madd(nz, nz, nw * nw))));
+                store(QX, i, nx * invLen);
+                store(QY, i, ny * invLen);
+                store(QZ, i, nz * invLen);
+                store(QW, i, nw * invLen);
+            }
+        }
+
+        /**
+         * @brief Full semi-implicit Euler step without an intermediate solver pass.
+         * @param dt Time step in seconds.
+         * @param gravity Gravity acceleration.
+         */
+        void
+            integrate(float dt, const CVector3& gravity) {
+            integrateVelocities(dt, gravity);
+            integratePositions(dt);
+        }
+
+    private:
+        static std::size_t
+            paddedSize(int count) {
+            return static_cast<std::size_t>((count + SIMD::LANES - 1) / SIMD::LANES * SIMD::LANES);
+        }
+
+        /**
+         * @brief Builds the 3x3 rotation matrix (row major) of four unit quaternions.
+         */
+        static void
+            rotationMatrix(const SIMD::float4& x, const SIMD::float4& y,
+                           const SIMD::float4& z, const SIMD::float4& w, SIMD::float4 r[9]) {
+            const SIMD::float4 one(1.f), two(2.f);
+            const SIMD::float4 xx = x * x, yy = y * y, zz = z * z;
+            const SIMD::float4 xy = x * y, xz = x * z, yz = y * z;
+            const SIMD::float4 wx = w * x, wy = w * y, wz = w * z;
+            r[0] = one - two * (yy + zz); r[1] = two * (xy - wz);       r[2] = two * (xz + wy);
+            r[3] = two * (xy + wz);       r[4] = one - two * (xx + zz); r[5] = two * (yz - wx);
+            r[6] = two * (xz - wy);       r[7] = two * (yz + wx);       r[8] = one - two * (xx + yy);
+        }
+
+        SIMD::float4
+            load(Stream s, int i) const {
+            return SIMD::float4::loadu(&m_streams[s][i]);
+        }
+
+        void
+            store(Stream s, int i, const SIMD::float4& value) {
+            value.storeu(&m_streams[s][i]);
+        }
+
+        CVector3
+            get3(int first, int i) const {
+            return CVector3(m_streams[first][i], m_streams[first + 1][i], m_streams[first + 2][i]);
+        }
+
+        void
+            set3(int first, int i, const CVector3& v) {
+            m_streams[first][i] = v.x;
+            m_streams[first + 1][i] = v.y;
+            m_streams[first + 2][i] = v.z;
+        }
+
+        void
+            add3(int first, int i, const CVector3& v) {
+            m_streams[first][i] += v.x;
+            m_streams[first + 1][i] += v.y;
+            m_streams[first + 2][i] += v.z;
+        }
+
+        /**
+         * @brief Appends one padding body to every stream.
+         */
+        void
+            pushInert() {
+            for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s].push_back(s == QW ? 1.f : 0.f);
+        }
+
+        /**
+         * @brief Turns a slot back into a padding body.
+         */
+        void
+            resetInert(int i) {
+            for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s][i] = (s == QW ? 1.f : 0.f);
+        }
+
+        std::vector<float> m_streams[STREAM_COUNT];
+        int m_count;
+    };
+
+} // namespace EU
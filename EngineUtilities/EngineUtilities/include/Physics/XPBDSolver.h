@@ -0,0 +1,534 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+#include <Core/SIMD.h>
+#include <Vectors/Vector3.h>
+
+/**
+ * @file XPBDSolver.h
+ * @brief Extended position-based dynamics for cloth, ropes and soft bodies.
+ */
+
+namespace EU {
+
+    /**
+     * @class XPBDSolver
+     * @brief XPBD solver over particle streams with graph-coloured constraint batches.
+     *
+     * Particles are stored as one float stream per component. Distance and bending
+     * constraints are greedily coloured so no two constraints of a colour share a
+     * particle; each colour is then solved four constraints at a time with gathers
+     * and scatters that cannot conflict. Since the colours are independent sets,
+     * the range kernels (solveDistanceRange / solveBendingRange) can also be split
+     * across threads inside one colour.
+     *
+     * Usage: add particles and constraints, then call step() every frame; the
+     * constraints are (re)coloured on the first step after a topology change. Each
+     * substep does one constraint iteration, as recommended for XPBD.
+     */
+    class
+        XPBDSolver {
+    public:
+        /**
+         * @brief Index of each particle stream.
+         */
+        enum
+            Stream {
+            PX, PY, PZ,                 ///< Position.
+            OX, OY, OZ,                 ///< Position at the start of the substep.
+            VX, VY, VZ,                 ///< Velocity.
+            INV_MASS,                   ///< Inverse mass, 0 pins the particle.
+            STREAM_COUNT
+        };
+
+        /**
+         * @brief Constraint batches in SoA form, sorted by colour. Each colour range
+         *        is padded to SIMD::LANES with constraints on the sink particle.
+         */
+        struct
+            ConstraintBatches {
+            std::vector<int> index[3];          ///< Particle indices (distance uses the first two).
+            std::vector<float> restValue;       ///< Rest length (distance) or rest height (bending).
+            std::vector<float> compliance;      ///< Inverse stiffness, 0 is rigid.
+            std::vector<float> lambda;          ///< Accumulated multiplier of the current substep.
+            std::vector<int> colorOffsets;      ///< colorOffsets[c]..colorOffsets[c + 1] is colour c.
+
+            int
+                colorCount() const {
+                return colorOffsets.empty() ? 0 : static_cast<int>(colorOffsets.size()) - 1;
+            }
+        };
+
+        CVector3 gravity = CVector3(0.f, -9.81f, 0.f);
+        int substeps = 8;               ///< Substeps per step() call.
+        float damping = 0.f;            ///< Fraction of velocity removed per second.
+        float thickness = 0.01f;        ///< Particle radius used by the colliders.
+
+        XPBDSolver() : m_count(0), m_sink(0), m_dirty(true) {}
+
+        // Setup
+
+        /**
+         * @brief Adds a particle.
+         * @param position Initial world-space position.
+         * @param inverseMass Inverse mass; 0 pins the particle in place.
+         * @return Particle index.
+         */
+        int
+            addParticle(const CVector3& position, float inverseMass) {
+            const int index = m_count++;
+            const std::size_t padded = static_cast<std::size_t>((m_count + SIMD::LANES) / SIMD::LANES * SIMD::LANES);
+            if (m_streams[PX].size() < padded) {
+                for (int s = 0; s < STREAM_COUNT; ++s) m_streams[s].resize(padded, 0.f);
+                m_sink = static_cast<int>(padded) - 1;
+            }
+            m_streams[PX][index] = m_streams[OX][index] = position.x;
+            m_streams[PY][index] = m_streams[OY][index] = position.y;
+            m_streams[PZ][index] = m_streams[OZ][index] = position.z;
+            m_streams[INV_MASS][index] = inverseMass;
+            // The sink may have moved, so the padded batches must be rebuilt.
+            m_dirty = true;
+            return index;
+        }
+
+        /**
+         * @brief Keeps two particles at their current distance.
+         * @param compliance Inverse stiffness in m/N; 0 makes the link inextensible.
+         */
+        void
+            addDistanceConstraint(int a, int b, float compliance = 0.f) {
+            RawConstraint c;
+            c.i[0] = a; c.i[1] = b; c.i[2] = a;
+            c.rest = (position(b) - position(a)).length();
+            c.compliance = compliance;
+            m_rawDistance.push_back(c);
+            m_dirty = true;
+        }
+
+        /**
+         * @brief Bending constraint on three consecutive particles: keeps the middle one at
+         *        its current distance from the centroid of the triple, so it resists folding
+         *        without dihedral angles.
+         * @param compliance Inverse stiffness; cloth usually wants a soft value here.
+         */
+        void
+            addBendingConstraint(int a, int middle, int b, float compliance) {
+            RawConstraint c;
+            c.i[0] = a; c.i[1] = middle; c.i[2] = b;
+            CVector3 centroid = (position(a) + position(middle) + position(b)) / 3.f;
+            c.rest = (position(middle) - centroid).length();
+            c.compliance = compliance;
+            m_rawBending.push_back(c);
+            m_dirty = true;
+        }
+
+        /**
+         * @brief Adds a half-space collider: particles stay where normal . x >= offset.
+         * @param normal Unit plane normal.
+         */
+        void
+            addPlaneCollider(const CVector3& normal, float offset) {
+            Plane p;
+            p.normal = normal;
+            p.offset = offset;
+            m_planes.push_back(p);
+        }
+
+        /**
+         * @brief Adds a solid sphere collider.
+         */
+        void
+            addSphereCollider(const CVector3& center, float radius) {
+            Sphere s;
+            s.center = center;
+            s.radius = radius;
+            m_spheres.push_back(s);
+        }
+
+        /**
+         * @brief Removes every collider.
+         */
+        void
+            clearColliders() {
+            m_planes.clear();
+            m_spheres.clear();
+        }
+
+        /**
+         * @brief Colours the constraints into padded batches. step() calls it
+         *        automatically after particles or constraints were added.
+         */
+        void
+            build() {
+            colorConstraints(m_rawDistance, 2, m_distance);
+            colorConstraints(m_rawBending, 3, m_bending);
+            m_dirty = false;
+        }
+
+        // Particle access
+
+        int
+            particleCount() const {
+            return m_count;
+        }
+
+        CVector3
+            position(int i) const {
+            return CVector3(m_streams[PX][i], m_streams[PY][i], m_streams[PZ][i]);
+        }
+
+        /**
+         * @brief Moves a particle (e.g. a pinned one driven by animation).
+         */
+        void
+            setPosition(int i, const CVector3& p) {
+            m_streams[PX][i] = p.x;
+            m_streams[PY][i] = p.y;
+            m_streams[PZ][i] = p.z;
+        }
+
+        CVector3
+            velocity(int i) const {
+            return CVector3(m_streams[VX][i], m_streams[VY][i], m_streams[VZ][i]);
+        }
+
+        void
+            setInverseMass(int i, float inverseMass) {
+            m_streams[INV_MASS][i] = inverseMass;
+        }
+
+        /**
+         * @brief Raw particle stream for renderers and other batched kernels.
+         */
+        const float*
+            stream(Stream s) const {
+            return m_streams[s].data();
+        }
+
+        const ConstraintBatches&
+            distanceBatches() const {
+            return m_distance;
+        }
+
+        const ConstraintBatches&
+            bendingBatches() const {
+            return m_bending;
+        }
+
+        // Simulation
+
+        /**
+         * @brief Advances the simulation by dt, split into substeps.
+         */
+        void
+            step(float dt) {
+            if (m_dirty) build();
+            if (m_count == 0 || substeps <= 0) return;
+            const float h = dt / static_cast<float>(substeps);
+            const float invH2 = 1.f / (h * h);
+            for (int s = 0; s < substeps; ++s) {
+                predict(h);
+                resetLambdas(m_distance);
+                resetLambdas(m_bending);
+                for (int c = 0; c < m_distance.colorCount(); ++c) {
+                    solveDistanceRange(m_distance.colorOffsets[c], m_distance.colorOffsets[c + 1], invH2);
+                }
+                for (int c = 0; c < m_bending.colorCount(); ++c) {
+                    solveBendingRange(m_bending.colorOffsets[c], m_bending.colorOffsets[c + 1], invH2);
+                }
+                solveCollisions();
+                updateVelocities(h);
+            }
+        }
+
+        /**
+         * @brief Solves distance constraints [begin, end), four at a time. The range must
+         *        lie inside one colour and begin must be a multiple of SIMD::LANES.
+         * @param invH2 1 / substep^2, turns compliance into the XPBD alpha~.
+         */
+        void
+            solveDistanceRange(int begin, int end, float invH2) {
+            using SIMD::float4;
+            const ConstraintBatches& b = m_distance;
+            const float4 zero = float4::zero();
+            const float4 eps(1e-12f);
+            for (int k = begin; k < end; k += SIMD::LANES) {
+                const int* ia = &b.index[0][k];
+                const int* ib = &b.index[1][k];
+                float4 ax = gather(PX, ia), ay = gather(PY, ia), az = gather(PZ, ia);
+                float4 bx = gather(PX, ib), by = gather(PY, ib), bz = gather(PZ, ib);
+                const float4 wa = gather(INV_MASS, ia), wb = gather(INV_MASS, ib);
+
+                const float4 dx = ax - bx, dy = ay - by, dz = az - bz;
+                const float4 len2 = SIMD::dot3(dx, dy, dz, dx, dy, dz);
+                const float4 len = SIMD::sqrt(len2);
+                const float4 alpha = float4::loadu(&b.compliance[k]) * float4(invH2);
+                const float4 lambda = float4::loadu(&m_distance.lambda[k]);
+                const float4 denom = wa + wb + alpha;
+                const float4 valid = (denom > zero) & (len2 > eps);
+
+                const float4 c = len - float4::loadu(&b.restValue[k]);
+                const float4 dLambda = SIMD::select(valid, (-c - alpha * lambda) / denom, zero);
+                (lambda + dLambda).storeu(&m_distance.lambda[k]);
+
+                // Gradient of C with respect to a is the unit direction from b to a.
+                const float4 s = SIMD::select(valid, dLambda / len, zero);
+                ax += dx * s * wa; ay += dy * s * wa; az += dz * s * wa;
+                bx -= dx * s * wb; by -= dy * s * wb; bz -= dz * s * wb;
+                scatter(PX, ia, ax); scatter(PY, ia, ay); scatter(PZ, ia, az);
+                scatter(PX, ib, bx); scatter(PY, ib, by); scatter(PZ, ib, bz);
+            }
+        }
+
+        /**
+         * @brief Solves bending constraints [begin, end), four at a time. Same rules as
+         *        solveDistanceRange().
+         */
+        void
+            solveBendingRange(int begin, int end, float invH2) {
+            using SIMD::float4;
+            const ConstraintBatches& b = m_bending;
+            const float4 zero = float4::zero();
+            const float4 eps(1e-12f);
+            const float4 third(1.f / 3.f), twoThirds(2.f / 3.f);
+            const float4 ninth(1.f / 9.f), fourNinths(4.f / 9.f);
+            for (int k = begin; k < end; k += SIMD::LANES) {
+                const int* i0 = &b.index[0][k];
+                const int* i1 = &b.index[1][k];
+                const int* i2 = &b.index[2][k];
+                float4 x0 = gather(PX, i0), y0 = gather(PY, i0), z0 = gather(PZ, i0);
+                float4 x1 = gather(PX, i1), y1 = gather(PY, i1), z1 = gather(PZ, i1);
+                float4 x2 = gather(PX, i2), y2 = gather(PY, i2), z2 = gather(PZ, i2);
+                const float4 w0 = gather(INV_MASS, i0), w1 = gather(INV_MASS, i1), w2 = gather(INV_MASS, i2);
+
+                // d = x1 - centroid; dC/dx1 = 2/3 n, dC/dx0 = dC/dx2 = -1/3 n.
+                const float4 dx = (x1 + x1 - x0 - x2) * third;
+                const float4 dy = (y1 + y1 - y0 - y2) * third;
+                const float4 dz = (z1 + z1 - z0 - z2) * third;
+                const float4 len2 = SIMD::dot3(dx, dy, dz, dx, dy, dz);
+                const float4 len = SIMD::sqrt(len2);
+                const float4 alpha = float4::loadu(&b.compliance[k]) * float4(invH2);
+                const float4 lambda = float4::loadu(&m_bending.lambda[k]);
+                const float4 denom = madd(w0 + w2, ninth, madd(w1, fourNinths, alpha));
+                const float4 valid = (denom > zero) & (len2 > eps);
+
+                const float4 c = len - float4::loadu(&b.restValue[k]);
+                const float4 dLambda = SIMD::select(valid, (-c - alpha * lambda) / denom, zero);
+                (lambda + dLambda).storeu(&m_bending.lambda[k]);
+
+                const float4 s = SIMD::select(valid, dLambda / len, zero);
+                const float4 s1 = s * twoThirds * w1;
+                const float4 s0 = s * third * w0;
+                const float4 s2 = s * third * w2;
+                x1 += dx * s1; y1 += dy * s1; z1 += dz * s1;
+                x0 -= dx * s0; y0 -= dy * s0; z0 -= dz * s0;
+                x2 -= dx * s2; y2 -= dy * s2; z2 -= dz * s2;
+                scatter(PX, i0, x0); scatter(PY, i0, y0); scatter(PZ, i0, z0);
+                scatter(PX, i1, x1); scatter(PY, i1, y1); scatter(PZ, i1, z1);
+                scatter(PX, i2, x2); scatter(PY, i2, y2); scatter(PZ, i2, z2);
+            }
+        }
+
+    private:
+        struct
+            RawConstraint {
+            int i[3];
+            float rest;
+            float compliance;
+        };
+
+        struct
+            Plane {
+            CVector3 normal;
+            float offset;
+        };
+
+        struct
+            Sphere {
+            CVector3 center;
+            float radius;
+        };
+
+        SIMD::float4
+            load(Stream s, int i) const {
+            return SIMD::float4::loadu(&m_streams[s][i]);
+        }
+
+        void
+            store(Stream s, int i, const SIMD::float4& value) {
+            value.storeu(&m_streams[s][i]);
+        }
+
+        SIMD::float4
+            gather(Stream s, const int* idx) const {
+            const float* p = m_streams[s].data();
+            return SIMD::float4(p[idx[0]], p[idx[1]], p[idx[2]], p[idx[3]]);
+        }
+
+        void
+            scatter(Stream s, const int* idx, const SIMD::float4& value) {
+            alignas(16) float tmp[SIMD::LANES];
+            value.store(tmp);
+            float* p = m_streams[s].data();
+            for (int k = 0; k < SIMD::LANES; ++k) p[idx[k]] = tmp[k];
+        }
+
+        /**
+         * @brief Greedy colouring: each constraint takes the lowest colour not yet used by
+         *        any of its particles. Colours are then laid out contiguously and padded.
+         */
+        void
+            colorConstraints(const std::vector<RawConstraint>& raw, int arity, ConstraintBatches& out) {
+            for (int k = 0; k < 3; ++k) out.index[k].clear();
+            out.restValue.clear();
+            out.compliance.clear();
+            out.lambda.clear();
+            out.colorOffsets.clear();
+            if (raw.empty()) return;
+
+            // Greedy colouring never needs more than arity * (maxDegree - 1) + 1 colours.
+            std::vector<int> degree(m_count, 0);
+            for (const RawConstraint& c : raw) {
+                for (int k = 0; k < arity; ++k) ++degree[c.i[k]];
+            }
+            int maxDegree = 0;
+            for (int d : degree) maxDegree = d > maxDegree ? d : maxDegree;
+            const int maxColors = arity * maxDegree + 1;
+            const int words = (maxColors + 63) / 64;
+
+            std::vector<std::uint64_t> used(static_cast<std::size_t>(m_count) * words, 0);
+            std::vector<int> color(raw.size());
+            std::vector<int> perColor;
+            for (std::size_t r = 0; r < raw.size(); ++r) {
+                int c = 0;
+                for (; c < maxColors; ++c) {
+                    const std::uint64_t bit = std::uint64_t(1) << (c & 63);
+                    bool taken = false;
+                    for (int k = 0; k < arity && !taken; ++k) {
+                        taken = (used[static_cast<std::size_t>(raw[r].i[k]) * words + (c >> 6)] & bit) != 0;
+                    }
+                    if (!taken) break;
+                }
+                for (int k = 0; k < arity; ++k) {
+                    used[static_cast<std::size_t>(raw[r].i[k]) * words + (c >> 6)] |= std::uint64_t(1) << (c & 63);
+                }
+                color[r] = c;
+                if (c >= static_cast<int>(perColor.size())) perColor.resize(c + 1, 0);
+                ++perColor[c];
+            }
+
+            int total = 0;
+            for (int c = 0; c < static_cast<int>(perColor.size()); ++c) {
+                out.colorOffsets.push_back(total);
+                total += (perColor[c] + SIMD::LANES - 1) / SIMD::LANES * SIMD::LANES;
+            }
+            out.colorOffsets.push_back(total);
+
+            // Padding slots point at the sink particle, whose zero inverse mass masks them out.
+            for (int k = 0; k < 3; ++k) out.index[k].assign(total, m_sink);
+            out.restValue.assign(total, 0.f);
+            out.compliance.assign(total, 0.f);
+            out.lambda.assign(total, 0.f);
+            std::vector<int> cursor(out.colorOffsets.begin(), out.colorOffsets.end() - 1);
+            for (std::size_t r = 0; r < raw.size(); ++r) {
+                const int slot = cursor[color[r]]++;
+                for (int k = 0; k < 3; ++k) out.index[k][slot] = raw[r].i[k];
+                out.restValue[slot] = raw[r].rest;
+                out.compliance[slot] = raw[r].compliance;
+            }
+        }
+
+        void
+            resetLambdas(ConstraintBatches& batches) {
+            for (float& l : batches.lambda) l = 0.f;
+        }
+
+        /**
+         * @brief Stores the substep start and moves free particles by their velocity.
+         */
+        void
+            predict(float h) {
+            using SIMD::float4;
+            const float4 vh(h);
+            const float4 zero = float4::zero();
+            const float4 gx(gravity.x * h), gy(gravity.y * h), gz(gravity.z * h);
+            const int n = static_cast<int>(m_streams[PX].size());
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                const float4 free = load(INV_MASS, i) > zero;
+                const float4 vx = load(VX, i) + (gx & free);
+                const float4 vy = load(VY, i) + (gy & free);
+                const float4 vz = load(VZ, i) + (gz & free);
+                const float4 px = load(PX, i), py = load(PY, i), pz = load(PZ, i);
+                store(OX, i, px); store(OY, i, py); store(OZ, i, pz);
+                store(VX, i, vx); store(VY, i, vy); store(VZ, i, vz);
+                store(PX, i, madd(vx, vh, px));
+                store(PY, i, madd(vy, vh, py));
+                store(PZ, i, madd(vz, vh, pz));
+            }
+        }
+
+        /**
+         * @brief Projects free particles out of the planes and spheres.
+         */
+        void
+            solveCollisions() {
+            using SIMD::float4;
+            const float4 zero = float4::zero();
+            const float4 radius(thickness);
+            const int n = static_cast<int>(m_streams[PX].size());
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                const float4 free = load(INV_MASS, i) > zero;
+                float4 px = load(PX, i), py = load(PY, i), pz = load(PZ, i);
+                for (const Plane& plane : m_planes) {
+                    const float4 nx(plane.normal.x), ny(plane.normal.y), nz(plane.normal.z);
+                    const float4 c = SIMD::dot3(px, py, pz, nx, ny, nz) - float4(plane.offset) - radius;
+                    const float4 push = SIMD::select(free & (c < zero), c, zero);
+                    px -= nx * push; py -= ny * push; pz -= nz * push;
+                }
+                for (const Sphere& sphere : m_spheres) {
+                    const float4 dx = px - float4(sphere.center.x);
+                    const float4 dy = py - float4(sphere.center.y);
+                    const float4 dz = pz - float4(sphere.center.z);
+                    const float4 len2 = SIMD::dot3(dx, dy, dz, dx, dy, dz);
+                    const float4 len = SIMD::sqrt(len2);
+                    const float4 c = len - float4(sphere.radius) - radius;
+                    const float4 hit = free & (c < zero) & (len2 > float4(1e-12f));
+                    const float4 s = SIMD::select(hit, c / len, zero);
+                    px -= dx * s; py -= dy * s; pz -= dz * s;
+                }
+                store(PX, i, px); store(PY, i, py); store(PZ, i, pz);
+            }
+        }
+
+        /**
+         * @brief v = (x - x_start) / h, with optional damping.
+         */
+        void
+            updateVelocities(float h) {
+            using SIMD::float4;
+            const float4 invH(1.f / h);
+            const float4 scale(1.f / (1.f + h * damping));
+            const float4 factor = invH * scale;
+            const int n = static_cast<int>(m_streams[PX].size());
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                store(VX, i, (load(PX, i) - load(OX, i)) * factor);
+                store(VY, i, (load(PY, i) - load(OY, i)) * factor);
+                store(VZ, i, (load(PZ, i) - load(OZ, i)) * factor);
+            }
+        }
+
+        std::vector<float> m_streams[STREAM_COUNT];
+        std::vector<RawConstraint> m_rawDistance;
+        std::vector<RawConstraint> m_rawBending;
+        std::vector<Plane> m_planes;
+        std::vector<Sphere> m_spheres;
+        ConstraintBatches m_distance;
+        ConstraintBatches m_bending;
+        int m_count;
+        int m_sink;
+        bool m_dirty;
+    };
+
+} // namespace EU
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <Core/SIMD.h>
+#include <Core/SIMDPoints.h>
+#include <Vectors/Vector3.h>
+#include <Matrices/Matrix4x4.h>
+#include <Geometry/Frustum.h>
+#include <Geometry/Ray.h>
+
+/**
+ * @file Camera.h
+ * @brief Camera with cached view, projection, view-projection, inverse and frustum,
+ *        and batched world <-> screen projection.
+ *
+ * Right-handed, looking down -Z in view space, clip z in [-1, 1] (the GL convention
+ * used by SFMLInterop::toGlsl). Setters only mark what depends on them dirty; the
+ * products are rebuilt on first use. View and projection inverses are built in closed
+ * form, so no general 4x4 inversion is ever done. Screen coordinates are pixels inside
+ * the viewport, origin top-left and y down, like an SFML window.
+ */
+
+namespace EU {
+
+    /**
+     * @class Camera
+     * @brief View and projection state plus the derived matrices.
+     */
+    class
+        Camera {
+    public:
+        /**
+         * @brief Default constructor. At the origin looking down -Z, 60 degree
+         *        perspective, aspect 1, depth range [0.1, 1000], 1x1 viewport.
+         */
+        Camera()
+            : m_viewportX(0.f), m_viewportY(0.f), m_viewportWidth(1.f), m_viewportHeight(1.f),
+              m_dirty(VIEW_PROJECTION_DIRTY | INVERSE_DIRTY | FRUSTUM_DIRTY) {
+            setPerspective(60.f * Constants::DEG_TO_RAD, 1.f, 0.1f, 1000.f);
+        }
+
+        // Projection builders
+
+        /**
+         * @brief Perspective projection.
+         * @param fovY Vertical field of view in radians.
+         * @param aspect Width / height.
+         * @param zNear Near plane distance (> 0).
+         * @param zFar Far plane distance.
+         * @param inverse If not null, receives the inverse matrix.
+         */
+        static Matrix4x4
+            perspective(float fovY, float aspect, float zNear, float zFar, Matrix4x4* inverse = nullptr) {
+            SIMD::float4 s, c;
+            SIMD::sinCos(SIMD::float4(0.5f * fovY), s, c);
+            const float f = c.lane(0) / s.lane(0);
+            const float a = (zFar + zNear) / (zNear - zFar);
+            const float b = 2.f * zFar * zNear / (zNear - zFar);
+            if (inverse) {
+                *inverse = Matrix4x4(aspect / f, 0.f, 0.f, 0.f,
+                                     0.f, 1.f / f, 0.f, 0.f,
+                                     0.f, 0.f, 0.f, -1.f,
+                                     0.f, 0.f, 1.f / b, a / b);
+            }
+            return Matrix4x4(f / aspect, 0.f, 0.f, 0.f,
+                             0.f, f, 0.f, 0.f,
+                             0.f, 0.f, a, b,
+                             0.f, 0.f, -1.f, 0.f);
+        }
+
+        /**
+         * @brief Orthographic projection of the box [left, right] x [bottom, top] x
+         *        [-zNear, -zFar].
+         * @param inverse If not null, receives the inverse matrix.
+         */
+        static Matrix4x4
+            orthographic(float left, float right, float bottom, float top, float zNear, float zFar,
+                         Matrix4x4* inverse = nullptr) {
+            if (inverse) {
+                *inverse = Matrix4x4(0.5f * (right - left), 0.f, 0.f, 0.5f * (right + left),
+                                     0.f, 0.5f * (top - bottom), 0.f, 0.5f * (top + bottom),
+                                     0.f, 0.f, -0.5f * (zFar - zNear), -0.5f * (zFar + zNear),
+                                     0.f, 0.f, 0.f, 1.f);
+            }
+            return Matrix4x4(2.f / (right - left), 0.f, 0.f, -(right + left) / (right - left),
+                             0.f, 2.f / (top - bottom), 0.f, -(top + bottom) / (top - bottom),
+                             0.f, 0.f, -2.f / (zFar - zNear), -(zFar + zNear) / (zFar - zNear),
+                             0.f, 0.f, 0.f, 1.f);
+        }
+
+        /**
+         * @brief World-to-view matrix of an eye looking at target. If up is parallel to
+         *        the view direction another axis is used instead.
+         * @param inverse If not null, receives the view-to-world matrix.
+         */
+        static Matrix4x4
+            lookAtMatrix(const CVector3& eye, const CVector3& target, const CVector3& up, Matrix4x4* inverse = nullptr) {
+            const CVector3 forward = (target - eye).normalized();
+            CVector3 side = forward.cross(up).normalized();
+            if (side.lengthSquared() == 0.f) {
+                const CVector3 other = Math::abs(forward.y) < 0.9f ? CVector3(0.f, 1.f, 0.f) : CVector3(1.f, 0.f, 0.f);
+                side = forward.cross(other).normalized();
+            }
+            const CVector3 realUp = side.cross(forward);
+            if (inverse) {
+                *inverse = Matrix4x4(side.x, realUp.x, -forward.x, eye.x,
+                                     side.y, realUp.y, -forward.y, eye.y,
+                                     side.z, realUp.z, -forward.z, eye.z,
+                                     0.f, 0.f, 0.f, 1.f);
+            }
+            return Matrix4x4(side.x, side.y, side.z, -side.dot(eye),
+                             realUp.x, realUp.y, realUp.z, -realUp.dot(eye),
+                             -forward.x, -forward.y, -forward.z, forward.dot(eye),
+                             0.f, 0.f, 0.f, 1.f);
+        }
+
+        // Setters
+
+        void
+            setPerspective(float fovY, float aspect, float zNear, float zFar) {
+            m_projection = perspective(fovY, aspect, zNear, zFar, &m_inverseProjection);
+            m_dirty = VIEW_PROJECTION_DIRTY | INVERSE_DIRTY | FRUSTUM_DIRTY;
+        }
+
+        void
+            setOrthographic(float left, float right, float bottom, float top, float zNear, float zFar) {
+            m_projection = orthographic(left, right, bottom, top, zNear, zFar, &m_inverseProjection);
+            m_dirty = VIEW_PROJECTION_DIRTY | INVERSE_DIRTY | FRUSTUM_DIRTY;
+        }
+
+        void
+            lookAt(const CVector3& eye, const CVector3& target, const CVector3& up = CVector3(0.f, 1.f, 0.f)) {
+            m_view = lookAtMatrix(eye, target, up, &m_inverseView);
+            m_dirty = VIEW_PROJECTION_DIRTY | INVERSE_DIRTY | FRUSTUM_DIRTY;
+        }
+
+        /**
+         * @brief Screen rectangle in pixels used by the world <-> screen functions.
+         *        Does not change the projection aspect.
+         */
+        void
+            setViewport(float x, float y, float width, float height) {
+            m_viewportX = x;
+            m_viewportY = y;
+            m_viewportWidth = width;
+            m_viewportHeight = height;
+        }
+
+        // Matrices
+
+        const Matrix4x4&
+            getView() const { return m_view; }
+
+        const Matrix4x4&
+            getInverseView() const { return m_inverseView; }
+
+        const Matrix4x4&
+            getProjection() const { return m_projection; }
+
+        const Matrix4x4&
+            getInverseProjection() const { return m_inverseProjection; }
+
+        /**
+         * @brief Eye position (translation of the inverse view).
+         */
+        CVector3
+            getPosition() const {
+            return CVector3(m_inverseView.m[0][3], m_inverseView.m[1][3], m_inverseView.m[2][3]);
+        }
+
+        /**
+         * @brief projection * view, rebuilt only after a change.
+         */
+        const Matrix4x4&
+            getViewProjection() const {
+            if (m_dirty & VIEW_PROJECTION_DIRTY) {
+                m_viewProjection = m_projection * m_view;
+                m_dirty &= ~VIEW_PROJECTION_DIRTY;
+            }
+            return m_viewProjection;
+        }
+
+        /**
+         * @brief inverseView * inverseProjection, rebuilt only after a change.
+         */
+        const Matrix4x4&
+            getInverseViewProjection() const {
+            if (m_dirty & INVERSE_DIRTY) {
+                m_inverseViewProjection = m_inverseView * m_inverseProjection;
+                m_dirty &= ~INVERSE_DIRTY;
+            }
+            return m_inverseViewProjection;
+        }
+
+        /**
+         * @brief World-space frustum, rebuilt only after a change.
+         */
+        const Frustum&
+            getFrustum() const {
+            if (m_dirty & FRUSTUM_DIRTY) {
+                m_frustum = Frustum::fromMatrix(getViewProjection());
+                m_dirty &= ~FRUSTUM_DIRTY;
+            }
+            return m_frustum;
+        }
+
+        // Projection
+
+        /**
+         * @brief World points to (pixel x, pixel y, NDC depth), four per step. A depth
+         *        outside [-1, 1] means the point is before the near plane, past the far
+         *        plane or behind the camera; x and y are then meaningless.
+         */
+        void
+            worldToScreen(const CVector3* points, int count, CVector3* out) const {
+            using SIMD::float4;
+            float4 vp[4][4];
+            SIMD::broadcast(getViewProjection(), vp);
+            const float4 halfW(0.5f * m_viewportWidth), halfH(0.5f * m_viewportHeight);
+            const float4 centerX(m_viewportX + 0.5f * m_viewportWidth), centerY(m_viewportY + 0.5f * m_viewportHeight);
+            for (int base = 0; base < count; base += SIMD::LANES) {
+                const int lanes = count - base < SIMD::LANES ? count - base : SIMD::LANES;
+                float4 x, y, z, clip[4];
+                SIMD::gather(points + base, lanes, x, y, z);
+                SIMD::transformPoints(vp, x, y, z, clip);
+                const float4 invW = float4(1.f) / nonZero(clip[3]);
+                SIMD::scatter((clip[0] * invW) * halfW + centerX, centerY - (clip[1] * invW) * halfH, clip[2] * invW,
+                              lanes, out + base);
+            }
+        }
+
+        /**
+         * @brief Inverse of worldToScreen(): (pixel x, pixel y, NDC depth) to world,
+         *        depth -1 on the near plane and 1 on the far plane.
+         */
+        void
+            screenToWorld(const CVector3* screen, int count, CVector3* out) const {
+            using SIMD::float4;
+            float4 ivp[4][4];
+            SIMD::broadcast(getInverseViewProjection(), ivp);
+            const float4 sx(2.f / m_viewportWidth), sy(-2.f / m_viewportHeight);
+            const float4 ox(-1.f - 2.f * m_viewportX / m_viewportWidth), oy(1.f + 2.f * m_viewportY / m_viewportHeight);
+            for (int base = 0; base < count; base += SIMD::LANES) {
+                const int lanes = count - base < SIMD::LANES ? count - base : SIMD::LANES;
+                float4 px, py, pz, world[4];
+                SIMD::gather(screen + base, lanes, px, py, pz);
+                SIMD::transformPoints(ivp, SIMD::madd(px, sx, ox), SIMD::madd(py, sy, oy), pz, world);
+                const float4 invW = float4(1.f) / nonZero(world[3]);
+                SIMD::scatter(world[0] * invW, world[1] * invW, world[2] * invW, lanes, out + base);
+            }
+        }
+
+        /**
+         * @brief Picking ray through a pixel, from the near plane toward the far plane
+         *        (t in [0, 1] spans the depth range).
+         */
+        Ray
+            screenPointToRay(float x, float y) const {
+            const CVector3 ends[2] = { CVector3(x, y, -1.f), CVector3(x, y, 1.f) };
+            CVector3 world[2];
+            screenToWorld(ends, 2, world);
+            return Ray::fromSegment(world[0], world[1]);
+        }
+
+    private:
+        enum
+            DirtyFlags {
+            VIEW_PROJECTION_DIRTY = 1 << 0,
+            INVERSE_DIRTY = 1 << 1,
+            FRUSTUM_DIRTY = 1 << 2
+        };
+
+        /**
+         * @brief Replaces w == 0 (a point on the eye plane) with a tiny value so the
+         *        divide stays finite.
+         */
+        static SIMD::float4
+            nonZero(const SIMD::float4& w) {
+            return SIMD::select(w == SIMD::float4(0.f), SIMD::float4(1e-30f), w);
+        }
+
+        Matrix4x4 m_view;
+        Matrix4x4 m_inverseView;
+        Matrix4x4 m_projection;
+        Matrix4x4 m_inverseProjection;
+        float m_viewportX;
+        float m_viewportY;
+        float m_viewportWidth;
+        float m_viewportHeight;
+        mutable Matrix4x4 m_viewProjection;
+        mutable Matrix4x4 m_inverseViewProjection;
+        mutable Frustum m_frustum;
+        mutable unsigned int m_dirty;
+    };
+
+} // namespace EU
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstdint>
+#include <SFML/Graphics/View.hpp>
+#include <SFML/System/Vector2.hpp>
+#include <Core/SIMD.h>
+#include <Core/SIMDPoints.h>
+#include <Vectors/Vector3.h>
+#include <Matrices/Matrix4x4.h>
+#include <Rendering/Camera.h>
+
+/**
+ * @file ScreenProjection.h
+ * @brief Batched world-to-screen projection into sf::View coordinates, for
+ *        nameplates, markers and other HUD elements that follow 3D positions.
+ *
+ * One pass per four points: clip-space transform, near-plane rejection, a single
+ * reciprocal of w, and the mapping of NDC onto the view rectangle. The result
+ * comes with a visibility bit per point. The view's rotation is ignored. With the
+ * target's default view, the coordinates are window pixels.
+ */
+
+namespace EU {
+    namespace ScreenProjection {
+
+        /**
+         * @brief Number of 32-bit words of the visibility mask for count points.
+         */
+        inline int
+            maskWords(int count) {
+            return (count + 31) / 32;
+        }
+
+        /**
+         * @brief Tests bit i of a visibility mask.
+         */
+        inline bool
+            isVisible(const std::uint32_t* mask, int i) {
+            return (mask[i >> 5] >> (i & 31)) & 1u;
+        }
+
+        /**
+         * @brief Projects count world positions into view coordinates (y down).
+         * @param viewProjection World-to-clip matrix (clip z in [-1, 1], as Camera).
+         * @param view HUD view the results are drawn with.
+         * @param positions World positions.
+         * @param out Receives view coordinates; only meaningful where the mask bit is set.
+         * @param mask maskWords(count) words; bit i is set if point i is in front of
+         *        the near plane and inside the view rectangle grown by margin.
+         * @param margin Extra view units accepted around the rectangle, so partly
+         *        visible labels still show.
+         * @return Number of visible points.
+         */
+        inline int
+            project(const Matrix4x4& viewProjection, const sf::View& view, const CVector3* positions, int count,
+                    sf::Vector2f* out, std::uint32_t* mask, float margin = 0.f) {
+            using SIMD::float4;
+            const sf::Vector2f center = view.getCenter(), size = view.getSize();
+            const float4 halfW(0.5f * size.x), halfH(0.5f * size.y);
+            const float4 centerX(center.x), centerY(center.y);
+            // |ndc| limits including the margin; checked before mapping.
+            const float4 limitX(1.f + 2.f * margin / Math::abs(size.x)), limitY(1.f + 2.f * margin / Math::abs(size.y));
+            const float4 zero(0.f), one(1.f);
+            float4 rows[4][4];
+            SIMD::broadcast(viewProjection, rows);
+
+            int visible = 0;
+            for (int w = 0; w < maskWords(count); ++w) mask[w] = 0u;
+            for (int base = 0; base < count; base += SIMD::LANES) {
+                const int lanes = count - base < SIMD::LANES ? count - base : SIMD::LANES;
+                float4 px, py, pz, clip[4];
+                SIMD::gather(positions + base, lanes, px, py, pz);
+                SIMD::transformPoints(rows, px, py, pz, clip);
+                // In front of the near plane: z >= -w; w > 0 also drops points behind
+                // the eye of an off-center projection.
+                const float4 front = (clip[2] + clip[3] >= zero) & (clip[3] > zero);
+                const float4 invW = one / SIMD::select(front, clip[3], one);
+                const float4 ndcX = clip[0] * invW, ndcY = clip[1] * invW;
+                const float4 inside = front & (SIMD::abs(ndcX) <= limitX) & (SIMD::abs(ndcY) <= limitY);
+
+                alignas(16) float sx[4], sy[4];
+                SIMD::madd(ndcX, halfW, centerX).store(sx);
+                (centerY - ndcY * halfH).store(sy);
+                for (int k = 0; k < lanes; ++k) out[base + k] = sf::Vector2f(sx[k], sy[k]);
+
+                const unsigned int bits = static_cast<unsigned int>(SIMD::movemask(inside)) & ((1u << lanes) - 1u);
+                mask[base >> 5] |= static_cast<std::uint32_t>(bits) << (base & 31);
+                for (unsigned int b = bits; b; b &= b - 1u) ++visible;
+            }
+            return visible;
+        }
+
+        /**
+         * @brief project() with the camera's cached view-projection.
+         */
+        inline int
+            project(const Camera& camera, const sf::View& view, const CVector3* positions, int count,
+                    sf::Vector2f* out, std::uint32_t* mask, float margin = 0.f) {
+            return project(camera.getViewProjection(), view, positions, count, out, mask, margin);
+        }
+
+    } // namespace ScreenProjection
+} // namespace EU
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include <SFML/Graphics/Drawable.hpp>
+#include <SFML/Graphics/Rect.hpp>
+#include <SFML/Graphics/RenderStates.hpp>
+#include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/Texture.hpp>
+#include <SFML/Graphics/Vertex.hpp>
+#include <Core/SIMD.h>
+#include <Vectors/Vector2.h>
+
+/**
+ * @file SpriteBatch.h
+ * @brief Builds textured quads for many sprites at once and draws them with one
+ *        draw call per texture.
+ *
+ * Replaces per-object sf::Sprite drawing. Sprites are grouped by texture (stable,
+ * so the order inside a texture is kept; sprites of different textures no longer
+ * overlap in submission order). Corners are computed four sprites at a time with
+ * SIMD::sinCos and a 2x2 rotation, and written into a vertex buffer that keeps its
+ * capacity between frames.
+ */
+
+namespace EU {
+
+    /**
+     * @struct SpriteInput
+     * @brief SoA description of the sprites to batch. Every array has count entries.
+     */
+    struct
+        SpriteInput {
+        const CVector2* position = nullptr;             ///< Centre of the sprite.
+        const float* rotation = nullptr;                ///< Radians; nullptr for no rotation.
+        const CVector2* scale = nullptr;                ///< nullptr for (1, 1).
+        const sf::IntRect* textureRect = nullptr;       ///< Size and texture coordinates in pixels.
+        const sf::Texture* const* texture = nullptr;    ///< nullptr entries draw untextured.
+        const sf::Color* color = nullptr;               ///< nullptr for white.
+        int count = 0;
+    };
+
+    /**
+     * @class SpriteBatch
+     * @brief Vertex buffer of sf::Triangles quads grouped by texture.
+     */
+    class
+        SpriteBatch : public sf::Drawable {
+    public:
+        /**
+         * @struct Batch
+         * @brief Consecutive vertices sharing a texture.
+         */
+        struct
+            Batch {
+            const sf::Texture* texture;
+            std::size_t firstVertex;
+            std::size_t vertexCount;
+        };
+
+        /**
+         * @brief Rebuilds the vertices and batches from input.
+         */
+        void
+            build(const SpriteInput& input) {
+            sortByTexture(input);
+            const int n = input.count;
+            m_vertices.resize(static_cast<std::size_t>(n) * 6);
+
+            alignas(16) float cx[SIMD::LANES], cy[SIMD::LANES], angle[SIMD::LANES], hx[SIMD::LANES], hy[SIMD::LANES];
+            alignas(16) float x[4][SIMD::LANES], y[4][SIMD::LANES];
+            for (int i = 0; i < n; i += SIMD::LANES) {
+                const int lanes = n - i < SIMD::LANES ? n - i : SIMD::LANES;
+                for (int k = 0; k < SIMD::LANES; ++k) {
+                    const int s = m_order[static_cast<std::size_t>(k < lanes ? i + k : i)];
+                    const sf::IntRect& rect = input.textureRect[s];
+                    cx[k] = input.position[s].x;
+                    cy[k] = input.position[s].y;
+                    angle[k] = input.rotation ? input.rotation[s] : 0.f;
+                    hx[k] = 0.5f * static_cast<float>(rect.width) * (input.scale ? input.scale[s].x : 1.f);
+                    hy[k] = 0.5f * static_cast<float>(rect.height) * (input.scale ? input.scale[s].y : 1.f);
+                }
+                corners(cx, cy, angle, hx, hy, x, y);
+
+                for (int k = 0; k < lanes; ++k) {
+                    const int s = m_order[static_cast<std::size_t>(i + k)];
+                    const sf::IntRect& rect = input.textureRect[s];
+                    const float u0 = static_cast<float>(rect.left), v0 = static_cast<float>(rect.top);
+                    const float u1 = u0 + static_cast<float>(rect.width), v1 = v0 + static_cast<float>(rect.height);
+                    const sf::Vector2f uv[4] = {
+                        sf::Vector2f(u0, v0), sf::Vector2f(u1, v0), sf::Vector2f(u1, v1), sf::Vector2f(u0, v1)
+                    };
+                    const sf::Color color = input.color ? input.color[s] : sf::Color::White;
+                    static const int corner[6] = { 0, 1, 2, 0, 2, 3 };
+                    sf::Vertex* q = &m_vertices[static_cast<std::size_t>(i + k) * 6];
+                    for (int j = 0; j < 6; ++j) {
+                        q[j].position = sf::Vector2f(x[corner[j]][k], y[corner[j]][k]);
+                        q[j].color = color;
+                        q[j].texCoords = uv[corner[j]];
+                    }
+                }
+            }
+        }
+
+        const std::vector<Batch>&
+            batches() const {
+            return m_batches;
+        }
+
+        const std::vector<sf::Vertex>&
+            vertices() const {
+            return m_vertices;
+        }
+
+    protected:
+        /**
+         * @brief One draw call per batch; states.texture is replaced by the batch's.
+         */
+        void
+            draw(sf::RenderTarget& target, sf::RenderStates states) const override {
+            for (std::size_t b = 0; b < m_batches.size(); ++b) {
+                states.texture = m_batches[b].texture;
+                target.draw(&m_vertices[m_batches[b].firstVertex], m_batches[b].vertexCount, sf::Triangles, states);
+            }
+        }
+
+    private:
+        /**
+         * @brief Corners 0..3 (top-left, top-right, bottom-right, bottom-left before
+         *        rotation) of four sprites.
+         */
+        static void
+            corners(const float* cx, const float* cy, const float* angle, const float* hx, const float* hy,
+                    float x[4][SIMD::LANES], float y[4][SIMD::LANES]) {
+            using SIMD::float4;
+            float4 s, c;
+            SIMD::sinCos(float4::load(angle), s, c);
+            const float4 px = float4::load(cx), py = float4::load(cy);
+            const float4 ex = float4::load(hx), ey = float4::load(hy);
+            // Rotated half extents: (hx, 0) -> (a, b), (0, hy) -> (-e, d).
+            const float4 a = c * ex, b = s * ex, d = c * ey, e = s * ey;
+            (px - a + e).store(x[0]); (py - b - d).store(y[0]);
+            (px + a + e).store(x[1]); (py + b - d).store(y[1]);
+            (px + a - e).store(x[2]); (py + b + d).store(y[2]);
+            (px - a - e).store(x[3]); (py - b + d).store(y[3]);
+        }
+
+        /**
+         * @brief Counting sort of the sprite indices by texture, in order of first use.
+         */
+        void
+            sortByTexture(const SpriteInput& input) {
+            const int n = input.count;
+            m_textures.clear();
+            m_key.resize(static_cast<std::size_t>(n));
+            int last = -1;
+            for (int i = 0; i < n; ++i) {
+                const sf::Texture* t = input.texture ? input.texture[i] : nullptr;
+                if (last < 0 || m_textures[static_cast<std::size_t>(last)] != t) {
+                    last = -1;
+                    for (std::size_t k = 0; k < m_textures.size(); ++k) {
+                        if (m_textures[k] == t) { last = static_cast<int>(k); break; }
+                    }
+                    if (last < 0) {
+                        last = static_cast<int>(m_textures.size());
+                        m_textures.push_back(t);
+                    }
+                }
+                m_key[static_cast<std::size_t>(i)] = last;
+            }
+
+            m_batches.resize(m_textures.size());
+            m_start.assign(m_textures.size() + 1, 0);
+            for (int i = 0; i < n; ++i) ++m_start[static_cast<std::size_t>(m_key[static_cast<std::size_t>(i)]) + 1];
+            for (std::size_t k = 0; k < m_textures.size(); ++k) {
+                m_start[k + 1] += m_start[k];
+                m_batches[k].texture = m_textures[k];
+                m_batches[k].firstVertex = m_start[k] * 6;
+                m_batches[k].vertexCount = (m_start[k + 1] - m_start[k]) * 6;
+            }
+            m_order.resize(static_cast<std::size_t>(n));
+            for (int i = 0; i < n; ++i) {
+                m_order[m_start[static_cast<std::size_t>(m_key[static_cast<std::size_t>(i)])]++] = i;
+            }
+        }
+
+        std::vector<sf::Vertex> m_vertices;
+        std::vector<Batch> m_batches;
+        std::vector<const sf::Texture*> m_textures;
+        std::vector<int> m_key;
+        std::vector<int> m_order;
+        std::vector<std::size_t> m_start;
+    };
+
+} // namespace EU
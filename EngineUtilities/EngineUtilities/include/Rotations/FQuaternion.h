@@ -0,0 +1,161 @@
+#pragma once
+
+#include <Math/Fixed.h>
+#include <Vectors/FVector3.h>
+#include <Rotations/Quaternion.h>
+
+/**
+ * @file FQuaternion.h
+ * @brief Fixed-point quaternion with the same API as Quaternion, for
+ *        deterministic simulation.
+ */
+
+namespace EU {
+
+    /**
+     * @class FixedQuaternion
+     * @brief Rotation quaternion over a Fixed scalar T. Use the FQuaternion (Q16.16)
+     *        and FQuaternion_64 (Q32.32) typedefs.
+     */
+    template<class T>
+    class
+        FixedQuaternion {
+    public:
+        T x;
+        T y;
+        T z;
+        T w;
+
+        // Constructors
+
+        /**
+         * @brief Default constructor. Creates an identity quaternion (0,0,0,1).
+         */
+        FixedQuaternion() : x(), y(), z(), w(1) {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param x X component.
+         * @param y Y component.
+         * @param z Z component.
+         * @param w W component (real part).
+         */
+        FixedQuaternion(const T& x, const T& y, const T& z, const T& w) : x(x), y(y), z(z), w(w) {}
+
+        /**
+         * @brief Rounds a float quaternion to fixed point.
+         */
+        explicit FixedQuaternion(const Quaternion& q) : x(q.x), y(q.y), z(q.z), w(q.w) {}
+
+        /**
+         * @brief Converts to a float quaternion, e.g. for rendering.
+         */
+        Quaternion
+            toQuaternion() const {
+            return Quaternion(x.toFloat(), y.toFloat(), z.toFloat(), w.toFloat());
+        }
+
+        // Operators
+
+        /**
+         * @brief Multiplies two quaternions (combines rotations).
+         */
+        FixedQuaternion
+            operator*(const FixedQuaternion& other) const {
+            return FixedQuaternion(
+                w * other.x + x * other.w + y * other.z - z * other.y,
+                w * other.y - x * other.z + y * other.w + z * other.x,
+                w * other.z + x * other.y - y * other.x + z * other.w,
+                w * other.w - x * other.x - y * other.y - z * other.z
+            );
+        }
+
+        FixedQuaternion&
+            operator*=(const FixedQuaternion& other) {
+            *this = *this * other;
+            return *this;
+        }
+
+        bool
+            operator==(const FixedQuaternion& other) const {
+            return x == other.x && y == other.y && z == other.z && w == other.w;
+        }
+
+        bool
+            operator!=(const FixedQuaternion& other) const {
+            return !(*this == other);
+        }
+
+        // Utilities
+
+        T
+            length() const {
+            return Math::hypot(x, y, z, w);
+        }
+
+        void
+            normalize() {
+            *this = normalized();
+        }
+
+        FixedQuaternion
+            normalized() const {
+            const T len = length();
+            if (len == T()) return FixedQuaternion();
+            return FixedQuaternion(x / len, y / len, z / len, w / len);
+        }
+
+        FixedQuaternion
+            inverse() const {
+            const T lenSq = x * x + y * y + z * z + w * w;
+            if (lenSq == T()) return FixedQuaternion();
+            return FixedQuaternion(-x / lenSq, -y / lenSq, -z / lenSq, w / lenSq);
+        }
+
+        /**
+         * @brief Creates a quaternion from a unit axis and an angle in radians, using
+         *        the table-based sin and cos.
+         */
+        static FixedQuaternion
+            fromAxisAngle(const FixedVector3<T>& axis, const T& angle) {
+            const T halfAngle = angle / 2;
+            const T s = Math::sin(halfAngle);
+            return FixedQuaternion(axis.x * s, axis.y * s, axis.z * s, Math::cos(halfAngle));
+        }
+
+        /**
+         * @brief Rotates a vector by this (unit) quaternion.
+         */
+        FixedVector3<T>
+            rotate(const FixedVector3<T>& v) const {
+            // v + 2w (q x v) + 2 q x (q x v): no inverse, fewer roundings than q v q*.
+            const FixedVector3<T> q(x, y, z);
+            const FixedVector3<T> t = q.cross(v) * T(2);
+            return v + t * w + q.cross(t);
+        }
+
+        /**
+         * @brief Linearly interpolates and renormalizes, t clamped to [0, 1].
+         */
+        static FixedQuaternion
+            lerp(const FixedQuaternion& a, const FixedQuaternion& b, T t) {
+            if (t < T()) t = T();
+            if (t > T(1)) t = T(1);
+            return FixedQuaternion(
+                a.x + (b.x - a.x) * t,
+                a.y + (b.y - a.y) * t,
+                a.z + (b.z - a.z) * t,
+                a.w + (b.w - a.w) * t
+            ).normalized();
+        }
+
+        static FixedQuaternion
+            identity() {
+            return FixedQuaternion();
+        }
+    };
+
+    typedef FixedQuaternion<Fixed32> FQuaternion;
+    typedef FixedQuaternion<Fixed64> FQuaternion_64;
+
+} // namespace EU
@@ -2,6 +2,7 @@
 
 //#include "../Prerequisites.h"
 #include <Vectors/Vector3.h>
+#include <Matrices/Matrix3x3.h>
 #include <Math/EngineMath.h>
 
 namespace EU {
@@ -137,6 +138,22 @@ namespace EU {
             return CVector3(result.x, result.y, result.z);
         }
 
+        /**
+         * @brief Converts this (unit) quaternion to a 3x3 rotation matrix.
+         * @return Rotation matrix that rotates column vectors.
+         */
+        Matrix3x3
+            toMatrix() const {
+            float xx = x * x, yy = y * y, zz = z * z;
+            float xy = x * y, xz = x * z, yz = y * z;
+            float wx = w * x, wy = w * y, wz = w * z;
+            return Matrix3x3(
+                1.f - 2.f * (yy + zz), 2.f * (xy - wz), 2.f * (xz + wy),
+                2.f * (xy + wz), 1.f - 2.f * (xx + zz), 2.f * (yz - wx),
+                2.f * (xz - wy), 2.f * (yz + wx), 1.f - 2.f * (xx + yy)
+            );
+        }
+
         /**
          * @brief Linearly interpolates between two quaternions (not normalized).
          * @param a Start quaternion.
@@ -0,0 +1,391 @@
+#pragma once
+
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+#include <vector>
+#include <memory>
+#include <new>
+#include <utility>
+#include <cstdint>
+#include <type_traits>
+
+/**
+ * @file JobSystem.h
+ * @brief Work-stealing job scheduler with lock-free per-worker deques and a
+ *        range-based parallel_for.
+ */
+
+namespace EU {
+
+    /**
+     * @struct Job
+     * @brief Unit of work. A job finishes when its function returned and all of its
+     *        children finished. The callable is stored inline, so creating a job never
+     *        allocates. Jobs are 128 bytes on 64-byte boundaries, so two cache lines
+     *        each and neighbouring ring slots never share a line.
+     */
+    struct alignas(64)
+        Job {
+        static constexpr std::size_t PAYLOAD_SIZE = 104;
+
+        using Function = void (*)(Job& job);
+
+        Function function;
+        Job* parent;
+        std::atomic<int> unfinished;
+        alignas(8) unsigned char payload[PAYLOAD_SIZE];   ///< Callable storage; pads the job to 128 bytes.
+    };
+
+    static_assert(sizeof(Job) == 128, "Job must fill exactly two cache lines");
+
+    /**
+     * @class JobDeque
+     * @brief Fixed-capacity Chase-Lev deque. The owning thread pushes and pops at the
+     *        bottom; other threads steal from the top. No locks.
+     */
+    class
+        JobDeque {
+    public:
+        static constexpr std::int64_t CAPACITY = 4096;
+
+        JobDeque() : m_top(0), m_bottom(0) {
+            for (std::int64_t i = 0; i < CAPACITY; ++i) m_jobs[i].store(nullptr, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Owner only. Returns false if the deque is full.
+         */
+        bool
+            push(Job* job) {
+            const std::int64_t b = m_bottom.load(std::memory_order_relaxed);
+            const std::int64_t t = m_top.load(std::memory_order_acquire);
+            if (b - t >= CAPACITY) return false;
+            // Release on the slot publishes the job's contents to the thread that takes it.
+            m_jobs[b & (CAPACITY - 1)].store(job, std::memory_order_release);
+            m_bottom.store(b + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Owner only. Takes the most recently pushed job (LIFO, cache friendly).
+         */
+        Job*
+            pop() {
+            const std::int64_t b = m_bottom.load(std::memory_order_relaxed) - 1;
+            m_bottom.store(b, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            std::int64_t t = m_top.load(std::memory_order_relaxed);
+            if (t > b) {
+                m_bottom.store(b + 1, std::memory_order_relaxed);
+                return nullptr;
+            }
+            Job* job = m_jobs[b & (CAPACITY - 1)].load(std::memory_order_relaxed);
+            if (t == b) {
+                // Last job: race the thieves for it.
+                if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                    job = nullptr;
+                }
+                m_bottom.store(b + 1, std::memory_order_relaxed);
+            }
+            return job;
+        }
+
+        /**
+         * @brief Any thread. Takes the oldest job (FIFO), which tends to be the biggest.
+         */
+        Job*
+            steal() {
+            std::int64_t t = m_top.load(std::memory_order_acquire);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            const std::int64_t b = m_bottom.load(std::memory_order_acquire);
+            if (t >= b) return nullptr;
+            Job* job = m_jobs[t & (CAPACITY - 1)].load(std::memory_order_acquire);
+            if (!m_top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+                return nullptr;
+            }
+            return job;
+        }
+
+    private:
+        // top and bottom are written by different threads: keep them on separate cache lines.
+        std::atomic<std::int64_t> m_top;
+        char m_padTop[64 - sizeof(std::atomic<std::int64_t>)];
+        std::atomic<std::int64_t> m_bottom;
+        char m_padBottom[64 - sizeof(std::atomic<std::int64_t>)];
+        std::atomic<Job*> m_jobs[CAPACITY];
+    };
+
+    /**
+     * @class JobSystem
+     * @brief Pool of worker threads that execute jobs and steal from each other.
+     *
+     * The thread that constructs the system is worker 0 and takes part in the work
+     * whenever it calls wait() or parallel_for(). Jobs may only be created and run
+     * from that thread or from inside other jobs.
+     *
+     * Each worker allocates jobs from its own ring of MAX_JOBS slots, so a job must
+     * be finished before that worker has created MAX_JOBS more; waiting on every
+     * batch, as parallel_for() does, keeps this true.
+     */
+    class
+        JobSystem {
+    public:
+        static constexpr int MAX_JOBS = 4096;
+
+        /**
+         * @brief Starts the workers.
+         * @param threadCount Total threads including the calling one; 0 uses every core.
+         */
+        explicit JobSystem(int threadCount = 0) : m_running(true), m_sleeping(0) {
+            if (threadCount <= 0) threadCount = static_cast<int>(std::thread::hardware_concurrency());
+            if (threadCount <= 0) threadCount = 1;
+            for (int i = 0; i < threadCount; ++i) {
+                m_workers.emplace_back(new Worker());
+                m_workers.back()->owner = this;
+                m_workers.back()->index = i;
+                m_workers.back()->random = 0x9E3779B9u * static_cast<std::uint32_t>(i + 1);
+            }
+            currentWorker() = m_workers[0].get();
+            for (int i = 1; i < threadCount; ++i) {
+                m_threads.emplace_back(&JobSystem::workerLoop, this, i);
+            }
+        }
+
+        ~JobSystem() {
+            m_running.store(false, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> lock(m_sleepMutex);
+                m_wake.notify_all();
+            }
+            for (std::thread& t : m_threads) t.join();
+            if (currentWorker() == m_workers[0].get()) currentWorker() = nullptr;
+        }
+
+        JobSystem(const JobSystem&) = delete;
+        JobSystem& operator=(const JobSystem&) = delete;
+
+        /**
+         * @brief Number of threads executing jobs, including the owning thread.
+         */
+        int
+            threadCount() const {
+            return static_cast<int>(m_workers.size());
+        }
+
+        /**
+         * @brief Creates a job from a callable taking no arguments. It does not run
+         *        until run() is called.
+         * @param parent Optional parent; it will not finish before this job does.
+         */
+        template<class F>
+        Job*
+            create(F&& function, Job* parent = nullptr) {
+            typedef typename std::decay<F>::type Callable;
+            Callable callable(std::forward<F>(function));
+            return createWithJob([callable](Job&) { callable(); }, parent);
+        }
+
+        /**
+         * @brief Queues a job on the calling worker's deque (or runs it inline if full).
+         */
+        void
+            run(Job* job) {
+            Worker* w = currentWorker();
+            if (!w->jobs.push(job)) {
+                execute(job);
+                return;
+            }
+            if (m_sleeping.load(std::memory_order_relaxed) > 0) {
+                std::lock_guard<std::mutex> lock(m_sleepMutex);
+                m_wake.notify_one();
+            }
+        }
+
+        /**
+         * @brief Executes other jobs until the given job has finished.
+         */
+        void
+            wait(const Job* job) {
+            while (job->unfinished.load(std::memory_order_acquire) > 0) {
+                Job* next = findJob(currentWorker());
+                if (next) execute(next);
+                else std::this_thread::yield();
+            }
+        }
+
+        /**
+         * @brief Runs kernel(first, last) over disjoint sub-ranges covering [begin, end)
+         *        on every thread and returns when all of them are done.
+         *
+         * Ranges are split in halves on demand: the running job keeps the lower half and
+         * exposes the upper half for stealing, until a range is at most grain long. With
+         * grain = 0 it is chosen from the range size and the thread count so every thread
+         * gets several pieces to balance uneven work.
+         *
+         * @param kernel Callable as kernel(int first, int last), processing [first, last).
+         */
+        template<class F>
+        void
+            parallel_for(int begin, int end, const F& kernel, int grain = 0) {
+            if (end <= begin) return;
+            const int count = end - begin;
+            if (grain <= 0) {
+                grain = count / (threadCount() * 8);
+                if (grain < 1) grain = 1;
+            }
+            // Keep the number of pieces well below MAX_JOBS so no job slot is recycled
+            // while the batch is still running.
+            if (count / grain > MAX_JOBS / 4) grain = count / (MAX_JOBS / 4) + 1;
+            if (count <= grain || threadCount() == 1) {
+                kernel(begin, end);
+                return;
+            }
+            Job* root = createWithJob([](Job&) {}, nullptr);
+            run(createRangeJob(begin, end, grain, &kernel, root));
+            run(root);
+            wait(root);
+        }
+
+    private:
+        struct
+            Worker {
+            JobDeque jobs;
+            // new Job[] does not honour alignas(64) before C++17, so the ring is
+            // placed by hand inside an over-sized buffer.
+            std::unique_ptr<unsigned char[]> storage{ new unsigned char[MAX_JOBS * sizeof(Job) + alignof(Job)] };
+            Job* pool = alignedJobs(storage.get());
+            std::uint32_t allocated = 0;
+            std::uint32_t random = 1;
+            JobSystem* owner = nullptr;
+            int index = 0;
+
+            static Job*
+                alignedJobs(unsigned char* raw) {
+                const std::uintptr_t mask = alignof(Job) - 1;
+                Job* jobs = reinterpret_cast<Job*>((reinterpret_cast<std::uintptr_t>(raw) + mask) & ~mask);
+                for (int i = 0; i < MAX_JOBS; ++i) new (jobs + i) Job;
+                return jobs;
+            }
+        };
+
+        /**
+         * @brief Worker of the calling thread, shared by every translation unit.
+         */
+        static Worker*&
+            currentWorker() {
+            static thread_local Worker* worker = nullptr;
+            return worker;
+        }
+
+        template<class F>
+        Job*
+            createWithJob(F&& function, Job* parent) {
+            typedef typename std::decay<F>::type Callable;
+            static_assert(sizeof(Callable) <= Job::PAYLOAD_SIZE, "Job callable captures too much; capture by reference or pointer");
+            static_assert(alignof(Callable) <= 8, "Job callable is over-aligned");
+
+            Worker* w = currentWorker();
+            Job* job = &w->pool[w->allocated++ & (MAX_JOBS - 1)];
+            job->parent = parent;
+            job->unfinished.store(1, std::memory_order_relaxed);
+            if (parent) parent->unfinished.fetch_add(1, std::memory_order_relaxed);
+            new (job->payload) Callable(std::forward<F>(function));
+            job->function = [](Job& j) {
+                Callable* c = reinterpret_cast<Callable*>(j.payload);
+                (*c)(j);
+                c->~Callable();
+            };
+            return job;
+        }
+
+        template<class F>
+        Job*
+            createRangeJob(int begin, int end, int grain, const F* kernel, Job* parent) {
+            return createWithJob([this, begin, end, grain, kernel](Job& self) {
+                int last = end;
+                while (last - begin > grain) {
+                    const int mid = begin + (last - begin) / 2;
+                    run(createRangeJob(mid, last, grain, kernel, &self));
+                    last = mid;
+                }
+                (*kernel)(begin, last);
+            }, parent);
+        }
+
+        void
+            execute(Job* job) {
+            job->function(*job);
+            finish(job);
+        }
+
+        void
+            finish(Job* job) {
+            // Read the parent first: once the count hits zero a waiting thread may
+            // return and recycle this job's slot.
+            Job* parent = job->parent;
+            if (job->unfinished.fetch_sub(1, std::memory_order_acq_rel) == 1 && parent) {
+                finish(parent);
+            }
+        }
+
+        /**
+         * @brief Own deque first, then a steal attempt from every other worker starting
+         *        at a random victim.
+         */
+        Job*
+            findJob(Worker* self) {
+            Job* job = self->jobs.pop();
+            if (job) return job;
+            const int n = threadCount();
+            self->random ^= self->random << 13;
+            self->random ^= self->random >> 17;
+            self->random ^= self->random << 5;
+            const int start = static_cast<int>(self->random % static_cast<std::uint32_t>(n));
+            for (int k = 0; k < n; ++k) {
+                const int victim = (start + k) % n;
+                if (victim == self->index) continue;
+                job = m_workers[victim]->jobs.steal();
+                if (job) return job;
+            }
+            return nullptr;
+        }
+
+        void
+            workerLoop(int index) {
+            Worker* self = m_workers[index].get();
+            currentWorker() = self;
+            int idle = 0;
+            while (m_running.load(std::memory_order_acquire)) {
+                Job* job = findJob(self);
+                if (job) {
+                    execute(job);
+                    idle = 0;
+                    continue;
+                }
+                if (++idle < 64) {
+                    std::this_thread::yield();
+                    continue;
+                }
+                // Nothing to do for a while: sleep until run() signals or a short timeout
+                // (the timeout covers a notification racing with going to sleep).
+                std::unique_lock<std::mutex> lock(m_sleepMutex);
+                m_sleeping.fetch_add(1, std::memory_order_relaxed);
+                m_wake.wait_for(lock, std::chrono::milliseconds(1));
+                m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+                idle = 0;
+            }
+            currentWorker() = nullptr;
+        }
+
+        std::vector<std::unique_ptr<Worker>> m_workers;
+        std::vector<std::thread> m_threads;
+        std::atomic<bool> m_running;
+        std::atomic<int> m_sleeping;
+        std::mutex m_sleepMutex;
+        std::condition_variable m_wake;
+    };
+
+} // namespace EU
@@ -0,0 +1,180 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <vector>
+#include <Threading/JobSystem.h>
+
+/**
+ * @file TaskGraph.h
+ * @brief Reusable dependency graph of tasks executed on a JobSystem.
+ */
+
+namespace EU {
+
+    /**
+     * @class TaskGraph
+     * @brief Declare a frame pipeline once, run it every frame.
+     *
+     * Tasks are added with add() and ordered with precede(before, after). run()
+     * starts every task without predecessors; each finished task decrements the
+     * pending count of its successors and schedules the ones that reach zero, so
+     * independent branches run concurrently and no stage waits on a global barrier.
+     * A task may itself call JobSystem::parallel_for() to spread its work further.
+     *
+     * Nodes, edges and counters are allocated while the graph is declared; running
+     * it only resets the counters and creates jobs from the job system's pools.
+     */
+    class
+        TaskGraph {
+    public:
+        typedef int TaskId;
+
+        TaskGraph() : m_compiled(false), m_valid(false) {}
+
+        TaskGraph(const TaskGraph&) = delete;
+        TaskGraph& operator=(const TaskGraph&) = delete;
+
+        /**
+         * @brief Adds a task.
+         * @param work Function run once per frame.
+         * @param name Optional label for debugging and profiling.
+         * @return Id used to declare dependencies.
+         */
+        TaskId
+            add(std::function<void()> work, const std::string& name = std::string()) {
+            Node node;
+            node.work = std::move(work);
+            node.name = name;
+            m_nodes.push_back(std::move(node));
+            m_compiled = false;
+            return static_cast<TaskId>(m_nodes.size()) - 1;
+        }
+
+        /**
+         * @brief Declares that before must finish before after starts.
+         */
+        void
+            precede(TaskId before, TaskId after) {
+            m_nodes[before].successors.push_back(after);
+            m_compiled = false;
+        }
+
+        /**
+         * @brief Chains the tasks in order: precede(a, b), precede(b, c), ...
+         */
+        void
+            chain(std::initializer_list<TaskId> tasks) {
+            const TaskId* previous = nullptr;
+            for (const TaskId& id : tasks) {
+                if (previous) precede(*previous, id);
+                previous = &id;
+            }
+        }
+
+        int
+            size() const {
+            return static_cast<int>(m_nodes.size());
+        }
+
+        const std::string&
+            name(TaskId id) const {
+            return m_nodes[id].name;
+        }
+
+        /**
+         * @brief Counts predecessors and checks the graph has no cycle. run() calls it
+         *        after the graph changed.
+         * @return False if the dependencies contain a cycle.
+         */
+        bool
+            compile() {
+            const int n = size();
+            m_pending.reset(new std::atomic<int>[n > 0 ? n : 1]);
+            m_roots.clear();
+            for (Node& node : m_nodes) node.predecessors = 0;
+            for (const Node& node : m_nodes) {
+                for (TaskId s : node.successors) ++m_nodes[s].predecessors;
+            }
+
+            // Kahn's algorithm: every node must be reachable in topological order.
+            std::vector<int> remaining(n);
+            std::vector<TaskId> ready;
+            for (int i = 0; i < n; ++i) {
+                remaining[i] = m_nodes[i].predecessors;
+                if (remaining[i] == 0) {
+                    ready.push_back(i);
+                    m_roots.push_back(i);
+                }
+            }
+            int visited = 0;
+            while (!ready.empty()) {
+                const TaskId id = ready.back();
+                ready.pop_back();
+                ++visited;
+                for (TaskId s : m_nodes[id].successors) {
+                    if (--remaining[s] == 0) ready.push_back(s);
+                }
+            }
+            m_valid = visited == n;
+            m_compiled = true;
+            return m_valid;
+        }
+
+        /**
+         * @brief Runs every task once, respecting the dependencies, and returns when all
+         *        are done. Must be called from the JobSystem's owning thread or a job.
+         * @return False (and runs nothing) if the graph has a cycle.
+         */
+        bool
+            run(JobSystem& jobs) {
+            if (!m_compiled) compile();
+            if (!m_valid) return false;
+            if (m_nodes.empty()) return true;
+
+            for (int i = 0; i < size(); ++i) {
+                m_pending[i].store(m_nodes[i].predecessors, std::memory_order_relaxed);
+            }
+            Job* root = jobs.create([] {});
+            for (TaskId id : m_roots) schedule(jobs, id, root);
+            jobs.run(root);
+            jobs.wait(root);
+            return true;
+        }
+
+    private:
+        struct
+            Node {
+            std::function<void()> work;
+            std::string name;
+            std::vector<TaskId> successors;
+            int predecessors = 0;
+        };
+
+        void
+            schedule(JobSystem& jobs, TaskId id, Job* root) {
+            JobSystem* system = &jobs;
+            jobs.run(jobs.create([this, system, id, root] {
+                Node& node = m_nodes[id];
+                if (node.work) node.work();
+                // Successors become children of the root before this job finishes,
+                // so the root cannot complete while work is still being released.
+                for (TaskId s : node.successors) {
+                    if (m_pending[s].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                        schedule(*system, s, root);
+                    }
+                }
+            }, root));
+        }
+
+        std::vector<Node> m_nodes;
+        std::vector<TaskId> m_roots;
+        std::unique_ptr<std::atomic<int>[]> m_pending;
+        bool m_compiled;
+        bool m_valid;
+    };
+
+} // namespace EU
@@ -0,0 +1,275 @@
+#pragma once
+
+#include <Core/SIMD.h>
+#include <Vectors/Vector3.h>
+
+/**
+ * @file DVector3.h
+ * @brief Double-precision 3D vector with the same API as CVector3, for world-space
+ *        positions in large worlds, and the batch rebase to camera-relative floats.
+ *
+ * A float has 24 bits of mantissa: 100 km from the origin a CVector3 only resolves
+ * about 8 mm, which shows as jitter. Positions are kept in DVector3 and rebased
+ * (subtracted from the camera or island origin in double, then rounded) just
+ * before rendering or physics, where the values are small again.
+ */
+
+namespace EU {
+
+    /**
+     * @class DVector3
+     * @brief 3D vector of doubles.
+     */
+    class
+        DVector3 {
+    public:
+        double x;
+        double y;
+        double z;
+
+        // Constructors
+
+        /**
+         * @brief Default constructor. Initializes the vector to (0, 0, 0).
+         */
+        DVector3() : x(0.0), y(0.0), z(0.0) {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param x The X component.
+         * @param y The Y component.
+         * @param z The Z component.
+         */
+        DVector3(double x, double y, double z) : x(x), y(y), z(z) {}
+
+        /**
+         * @brief Widens a float vector.
+         */
+        explicit DVector3(const CVector3& v) : x(v.x), y(v.y), z(v.z) {}
+
+        /**
+         * @brief Rounds to a float vector. Only meaningful near the origin; use
+         *        relativeTo() for world positions.
+         */
+        CVector3
+            toCVector3() const {
+            return CVector3(static_cast<float>(x), static_cast<float>(y), static_cast<float>(z));
+        }
+
+        /**
+         * @brief this - origin, computed in double and then rounded to float.
+         */
+        CVector3
+            relativeTo(const DVector3& origin) const {
+            return CVector3(static_cast<float>(x - origin.x), static_cast<float>(y - origin.y),
+                            static_cast<float>(z - origin.z));
+        }
+
+        // Arithmetic operators
+        DVector3
+            operator+(const DVector3& other) const {
+            return DVector3(x + other.x, y + other.y, z + other.z);
+        }
+
+        DVector3
+            operator-(const DVector3& other) const {
+            return DVector3(x - other.x, y - other.y, z - other.z);
+        }
+
+        /**
+         * @brief Offsets by a float vector, e.g. a camera-relative result.
+         */
+        DVector3
+            operator+(const CVector3& offset) const {
+            return DVector3(x + offset.x, y + offset.y, z + offset.z);
+        }
+
+        DVector3
+            operator*(double scalar) const {
+            return DVector3(x * scalar, y * scalar, z * scalar);
+        }
+
+        DVector3
+            operator/(double divisor) const {
+            return DVector3(x / divisor, y / divisor, z / divisor);
+        }
+
+        DVector3
+            operator-() const {
+            return DVector3(-x, -y, -z);
+        }
+
+        // Compound assignment operators
+        DVector3&
+            operator+=(const DVector3& other) {
+            x += other.x;
+            y += other.y;
+            z += other.z;
+            return *this;
+        }
+
+        DVector3&
+            operator-=(const DVector3& other) {
+            x -= other.x;
+            y -= other.y;
+            z -= other.z;
+            return *this;
+        }
+
+        DVector3&
+            operator*=(double scalar) {
+            x *= scalar;
+            y *= scalar;
+            z *= scalar;
+            return *this;
+        }
+
+        DVector3&
+            operator/=(double scalar) {
+            x /= scalar;
+            y /= scalar;
+            z /= scalar;
+            return *this;
+        }
+
+        // Comparison operators
+        bool
+            operator==(const DVector3& other) const {
+            return x == other.x && y == other.y && z == other.z;
+        }
+
+        bool
+            operator!=(const DVector3& other) const {
+            return !(*this == other);
+        }
+
+        // Index access
+
+        /**
+         * @brief Access vector components by index.
+         * @param index 0 for x, 1 for y, 2 for z.
+         */
+        double&
+            operator[](int index) {
+            return index == 0 ? x : (index == 1 ? y : z);
+        }
+
+        const double&
+            operator[](int index) const {
+            return index == 0 ? x : (index == 1 ? y : z);
+        }
+
+        // Geometric functions
+
+        double
+            length() const {
+            return SIMD::sqrt(SIMD::double2(lengthSquared())).lane(0);
+        }
+
+        double
+            lengthSquared() const {
+            return x * x + y * y + z * z;
+        }
+
+        double
+            dot(const DVector3& other) const {
+            return x * other.x + y * other.y + z * other.z;
+        }
+
+        DVector3
+            cross(const DVector3& other) const {
+            return DVector3(
+                y * other.z - z * other.y,
+                z * other.x - x * other.z,
+                x * other.y - y * other.x
+            );
+        }
+
+        /**
+         * @brief Returns a normalized copy, or (0, 0, 0) if the length is zero.
+         */
+        DVector3
+            normalized() const {
+            const double len = length();
+            if (len == 0.0) return DVector3();
+            return *this * (1.0 / len);
+        }
+
+        void
+            normalize() {
+            *this = normalized();
+        }
+
+        // Static utility methods
+
+        static double
+            distance(const DVector3& a, const DVector3& b) {
+            return (a - b).length();
+        }
+
+        /**
+         * @brief Linear interpolation with t clamped to [0, 1].
+         */
+        static DVector3
+            lerp(const DVector3& a, const DVector3& b, double t) {
+            if (t < 0.0) t = 0.0;
+            if (t > 1.0) t = 1.0;
+            return a + (b - a) * t;
+        }
+
+        static DVector3
+            zero() {
+            return DVector3();
+        }
+    };
+
+    static_assert(sizeof(DVector3) == 3 * sizeof(double), "DVector3 must be three packed doubles");
+    static_assert(sizeof(CVector3) == 3 * sizeof(float), "CVector3 must be three packed floats");
+
+    namespace LargeWorld {
+
+        /**
+         * @brief out[i] = positions[i] - origin, rounded to float. Works on four
+         *        positions (12 doubles, 12 floats) per step: the origin repeats every
+         *        three double pairs as (x, y), (z, x), (y, z).
+         */
+        inline void
+            rebase(const DVector3* positions, int count, const DVector3& origin, CVector3* out) {
+            using SIMD::double2;
+            const double2 o0(origin.x, origin.y), o1(origin.z, origin.x), o2(origin.y, origin.z);
+            const double* in = &positions[0].x;
+            float* dst = &out[0].x;
+            int i = 0;
+            for (; i + 4 <= count; i += 4) {
+                const double* p = in + 3 * i;
+                float* q = dst + 3 * i;
+                SIMD::toFloat(double2::loadu(p + 0) - o0, double2::loadu(p + 2) - o1).storeu(q + 0);
+                SIMD::toFloat(double2::loadu(p + 4) - o2, double2::loadu(p + 6) - o0).storeu(q + 4);
+                SIMD::toFloat(double2::loadu(p + 8) - o1, double2::loadu(p + 10) - o2).storeu(q + 8);
+            }
+            for (; i < count; ++i) out[i] = positions[i].relativeTo(origin);
+        }
+
+        /**
+         * @brief Same as rebase() for positions stored as separate x, y and z streams.
+         */
+        inline void
+            rebase(const double* x, const double* y, const double* z, int count, const DVector3& origin,
+                   float* outX, float* outY, float* outZ) {
+            using SIMD::double2;
+            const double* in[3] = { x, y, z };
+            float* out[3] = { outX, outY, outZ };
+            const double o[3] = { origin.x, origin.y, origin.z };
+            for (int c = 0; c < 3; ++c) {
+                const double2 oc(o[c]);
+                int i = 0;
+                for (; i + SIMD::LANES <= count; i += SIMD::LANES) {
+                    SIMD::toFloat(double2::loadu(in[c] + i) - oc, double2::loadu(in[c] + i + 2) - oc).storeu(out[c] + i);
+                }
+                for (; i < count; ++i) out[c][i] = static_cast<float>(in[c][i] - o[c]);
+            }
+        }
+
+    } // namespace LargeWorld
+
+} // namespace EU
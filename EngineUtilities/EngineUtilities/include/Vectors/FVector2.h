@@ -0,0 +1,233 @@
+#pragma once
+
+#include <Math/Fixed.h>
+#include <Vectors/Vector2.h>
+
+/**
+ * @file FVector2.h
+ * @brief Fixed-point 2D vector with the same API as CVector2, for deterministic
+ *        simulation.
+ */
+
+namespace EU {
+
+    /**
+     * @class FixedVector2
+     * @brief 2D vector over a Fixed scalar T. Use the FVector2 (Q16.16) and
+     *        FVector2_64 (Q32.32) typedefs.
+     */
+    template<class T>
+    class
+        FixedVector2 {
+    public:
+        T x;
+        T y;
+
+        // Constructors
+
+        /**
+         * @brief Default constructor. Initializes the vector to (0, 0).
+         */
+        FixedVector2() : x(), y() {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param x The X component.
+         * @param y The Y component.
+         */
+        FixedVector2(const T& x, const T& y) : x(x), y(y) {}
+
+        /**
+         * @brief Rounds a float vector to fixed point.
+         */
+        explicit FixedVector2(const CVector2& v) : x(v.x), y(v.y) {}
+
+        /**
+         * @brief Converts to a float vector, e.g. for rendering.
+         */
+        CVector2
+            toCVector2() const {
+            return CVector2(x.toFloat(), y.toFloat());
+        }
+
+        // Arithmetic operators
+        FixedVector2
+            operator+(const FixedVector2& other) const {
+            return FixedVector2(x + other.x, y + other.y);
+        }
+
+        FixedVector2
+            operator-(const FixedVector2& other) const {
+            return FixedVector2(x - other.x, y - other.y);
+        }
+
+        FixedVector2
+            operator*(const T& scalar) const {
+            return FixedVector2(x * scalar, y * scalar);
+        }
+
+        FixedVector2
+            operator/(const T& divisor) const {
+            return FixedVector2(x / divisor, y / divisor);
+        }
+
+        // Compound assignment operators
+        FixedVector2&
+            operator+=(const FixedVector2& other) {
+            x += other.x;
+            y += other.y;
+            return *this;
+        }
+
+        FixedVector2&
+            operator-=(const FixedVector2& other) {
+            x -= other.x;
+            y -= other.y;
+            return *this;
+        }
+
+        FixedVector2&
+            operator*=(const T& scalar) {
+            x *= scalar;
+            y *= scalar;
+            return *this;
+        }
+
+        FixedVector2&
+            operator/=(const T& scalar) {
+            x /= scalar;
+            y /= scalar;
+            return *this;
+        }
+
+        // Comparison operators
+        bool
+            operator==(const FixedVector2& other) const {
+            return x == other.x && y == other.y;
+        }
+
+        bool
+            operator!=(const FixedVector2& other) const {
+            return !(*this == other);
+        }
+
+        // Index access
+
+        /**
+         * @brief Access vector components by index.
+         * @param index 0 for x, 1 for y.
+         */
+        T&
+            operator[](int index) {
+            return index == 0 ? x : y;
+        }
+
+        const T&
+            operator[](int index) const {
+            return index == 0 ? x : y;
+        }
+
+        // Geometric functions
+
+        /**
+         * @brief Euclidean length. Computed from the exact sum of squares, so it does
+         *        not overflow even when lengthSquared() would.
+         */
+        T
+            length() const {
+            return Math::hypot(x, y);
+        }
+
+        T
+            lengthSquared() const {
+            return x * x + y * y;
+        }
+
+        T
+            dot(const FixedVector2& other) const {
+            return x * other.x + y * other.y;
+        }
+
+        /**
+         * @brief 2D cross product (scalar z).
+         */
+        T
+            cross(const FixedVector2& other) const {
+            return x * other.y - y * other.x;
+        }
+
+        /**
+         * @brief Returns a normalized copy, or (0, 0) if the length is zero.
+         */
+        FixedVector2
+            normalized() const {
+            const T len = length();
+            if (len == T()) return FixedVector2();
+            return FixedVector2(x / len, y / len);
+        }
+
+        void
+            normalize() {
+            *this = normalized();
+        }
+
+        // Static utility methods
+
+        static T
+            distance(const FixedVector2& a, const FixedVector2& b) {
+            return (a - b).length();
+        }
+
+        /**
+         * @brief Linear interpolation with t clamped to [0, 1].
+         */
+        static FixedVector2
+            lerp(const FixedVector2& a, const FixedVector2& b, T t) {
+            if (t < T()) t = T();
+            if (t > T(1)) t = T(1);
+            return a + (b - a) * t;
+        }
+
+        static FixedVector2
+            zero() {
+            return FixedVector2();
+        }
+
+        static FixedVector2
+            one() {
+            return FixedVector2(T(1), T(1));
+        }
+
+        // Transform-style debug methods
+
+        void
+            setPosition(const FixedVector2& position) {
+            *this = position;
+        }
+
+        void
+            move(const FixedVector2& offset) {
+            *this += offset;
+        }
+
+        void
+            setScale(const FixedVector2& factors) {
+            *this = factors;
+        }
+
+        void
+            scale(const FixedVector2& factors) {
+            x *= factors.x;
+            y *= factors.y;
+        }
+
+        void
+            setOrigin(const FixedVector2& origin) {
+            *this = origin;
+        }
+    };
+
+    typedef FixedVector2<Fixed32> FVector2;
+    typedef FixedVector2<Fixed64> FVector2_64;
+
+} // namespace EU
@@ -0,0 +1,241 @@
+#pragma once
+
+#include <Math/Fixed.h>
+#include <Vectors/Vector3.h>
+
+/**
+ * @file FVector3.h
+ * @brief Fixed-point 3D vector with the same API as CVector3, for deterministic
+ *        simulation.
+ */
+
+namespace EU {
+
+    /**
+     * @class FixedVector3
+     * @brief 3D vector over a Fixed scalar T. Use the FVector3 (Q16.16) and
+     *        FVector3_64 (Q32.32) typedefs.
+     */
+    template<class T>
+    class
+        FixedVector3 {
+    public:
+        T x;
+        T y;
+        T z;
+
+        // Constructors
+
+        /**
+         * @brief Default constructor. Initializes the vector to (0, 0, 0).
+         */
+        FixedVector3() : x(), y(), z() {}
+
+        /**
+         * @brief Parameterized constructor.
+         * @param x The X component.
+         * @param y The Y component.
+         * @param z The Z component.
+         */
+        FixedVector3(const T& x, const T& y, const T& z) : x(x), y(y), z(z) {}
+
+        /**
+         * @brief Rounds a float vector to fixed point.
+         */
+        explicit FixedVector3(const CVector3& v) : x(v.x), y(v.y), z(v.z) {}
+
+        /**
+         * @brief Converts to a float vector, e.g. for rendering.
+         */
+        CVector3
+            toCVector3() const {
+            return CVector3(x.toFloat(), y.toFloat(), z.toFloat());
+        }
+
+        // Arithmetic operators
+        FixedVector3
+            operator+(const FixedVector3& other) const {
+            return FixedVector3(x + other.x, y + other.y, z + other.z);
+        }
+
+        FixedVector3
+            operator-(const FixedVector3& other) const {
+            return FixedVector3(x - other.x, y - other.y, z - other.z);
+        }
+
+        FixedVector3
+            operator*(const T& scalar) const {
+            return FixedVector3(x * scalar, y * scalar, z * scalar);
+        }
+
+        FixedVector3
+            operator/(const T& divisor) const {
+            return FixedVector3(x / divisor, y / divisor, z / divisor);
+        }
+
+        // Compound assignment operators
+        FixedVector3&
+            operator+=(const FixedVector3& other) {
+            x += other.x;
+            y += other.y;
+            z += other.z;
+            return *this;
+        }
+
+        FixedVector3&
+            operator-=(const FixedVector3& other) {
+            x -= other.x;
+            y -= other.y;
+            z -= other.z;
+            return *this;
+        }
+
+        FixedVector3&
+            operator*=(const T& scalar) {
+            x *= scalar;
+            y *= scalar;
+            z *= scalar;
+            return *this;
+        }
+
+        FixedVector3&
+            operator/=(const T& scalar) {
+            x /= scalar;
+            y /= scalar;
+            z /= scalar;
+            return *this;
+        }
+
+        // Comparison operators
+        bool
+            operator==(const FixedVector3& other) const {
+            return x == other.x && y == other.y && z == other.z;
+        }
+
+        bool
+            operator!=(const FixedVector3& other) const {
+            return !(*this == other);
+        }
+
+        // Index access
+
+        /**
+         * @brief Access vector components by index.
+         * @param index 0 for x, 1 for y, 2 for z.
+         */
+        T&
+            operator[](int index) {
+            return index == 0 ? x : (index == 1 ? y : z);
+        }
+
+        const T&
+            operator[](int index) const {
+            return index == 0 ? x : (index == 1 ? y : z);
+        }
+
+        // Geometric functions
+
+        /**
+         * @brief Euclidean length. Computed from the exact sum of squares, so it does
+         *        not overflow even when lengthSquared() would.
+         */
+        T
+            length() const {
+            return Math::hypot(x, y, z);
+        }
+
+        T
+            lengthSquared() const {
+            return x * x + y * y + z * z;
+        }
+
+        T
+            dot(const FixedVector3& other) const {
+            return x * other.x + y * other.y + z * other.z;
+        }
+
+        FixedVector3
+            cross(const FixedVector3& other) const {
+            return FixedVector3(
+                y * other.z - z * other.y,
+                z * other.x - x * other.z,
+                x * other.y - y * other.x
+            );
+        }
+
+        /**
+         * @brief Returns a normalized copy, or (0, 0, 0) if the length is zero.
+         */
+        FixedVector3
+            normalized() const {
+            const T len = length();
+            if (len == T()) return FixedVector3();
+            return FixedVector3(x / len, y / len, z / len);
+        }
+
+        void
+            normalize() {
+            *this = normalized();
+        }
+
+        // Static utility methods
+
+        static T
+            distance(const FixedVector3& a, const FixedVector3& b) {
+            return (a - b).length();
+        }
+
+        /**
+         * @brief Linear interpolation with t clamped to [0, 1].
+         */
+        static FixedVector3
+            lerp(const FixedVector3& a, const FixedVector3& b, T t) {
+            if (t < T()) t = T();
+            if (t > T(1)) t = T(1);
+            return a + (b - a) * t;
+        }
+
+        static FixedVector3
+            zero() {
+            return FixedVector3();
+        }
+
+        static FixedVector3
+            one() {
+            return FixedVector3(T(1), T(1), T(1));
+        }
+
+        // Transform-style debug methods
+
+        void
+            setPosition(const FixedVector3& position) {
+            *this = position;
+        }
+
+        void
+            move(const FixedVector3& offset) {
+            *this += offset;
+        }
+
+        void
+            setScale(const FixedVector3& factors) {
+            *this = factors;
+        }
+
+        void
+            scale(const FixedVector3& factors) {
+            x *= factors.x;
+            y *= factors.y;
+            z *= factors.z;
+        }
+
+        void
+            setOrigin(const FixedVector3& origin) {
+            *this = origin;
+        }
+    };
+
+    typedef FixedVector3<Fixed32> FVector3;
+    typedef FixedVector3<Fixed64> FVector3_64;
+
+} // namespace EU
@@ -0,0 +1,149 @@
+#pragma once
+
+#include <cstdint>
+#include <Math/Half.h>
+#include <Vectors/Vector3.h>
+#include <Vectors/Vector4.h>
+
+/**
+ * @file PackedVectors.h
+ * @brief 16-bit storage variants of CVector3 and CVector4 (half, snorm16,
+ *        unorm16) for mesh and animation streams, with bulk array conversion.
+ *
+ * These are storage formats: unpack to CVector3/CVector4 (or straight into float
+ * streams) before doing math. Each halves the footprint of its float counterpart.
+ */
+
+static_assert(sizeof(CVector3) == 3 * sizeof(float), "CVector3 must be tightly packed for the bulk conversions");
+static_assert(sizeof(CVector4) == 4 * sizeof(float), "CVector4 must be tightly packed for the bulk conversions");
+
+namespace EU {
+
+    /**
+     * @struct HalfVector3
+     * @brief Three halves (6 bytes). For positions and offsets of moderate range.
+     */
+    struct
+        HalfVector3 {
+        std::uint16_t x, y, z;
+
+        HalfVector3() : x(0), y(0), z(0) {}
+
+        explicit HalfVector3(const CVector3& v)
+            : x(Packing::floatToHalf(v.x)), y(Packing::floatToHalf(v.y)), z(Packing::floatToHalf(v.z)) {}
+
+        CVector3
+            toCVector3() const {
+            return CVector3(Packing::halfToFloat(x), Packing::halfToFloat(y), Packing::halfToFloat(z));
+        }
+    };
+
+    /**
+     * @struct HalfVector4
+     * @brief Four halves (8 bytes). For HDR colours and general 4-component data.
+     */
+    struct
+        HalfVector4 {
+        std::uint16_t x, y, z, w;
+
+        HalfVector4() : x(0), y(0), z(0), w(0) {}
+
+        explicit HalfVector4(const CVector4& v)
+            : x(Packing::floatToHalf(v.x)), y(Packing::floatToHalf(v.y)),
+              z(Packing::floatToHalf(v.z)), w(Packing::floatToHalf(v.w)) {}
+
+        CVector4
+            toCVector4() const {
+            return CVector4(Packing::halfToFloat(x), Packing::halfToFloat(y), Packing::halfToFloat(z), Packing::halfToFloat(w));
+        }
+    };
+
+    /**
+     * @struct SNormVector3
+     * @brief Three signed normalized 16-bit values in [-1, 1] (6 bytes), uniform
+     *        precision of 3e-5. For normals and tangents.
+     */
+    struct
+        SNormVector3 {
+        std::int16_t x, y, z;
+
+        SNormVector3() : x(0), y(0), z(0) {}
+
+        explicit SNormVector3(const CVector3& v)
+            : x(Packing::floatToSnorm16(v.x)), y(Packing::floatToSnorm16(v.y)), z(Packing::floatToSnorm16(v.z)) {}
+
+        CVector3
+            toCVector3() const {
+            return CVector3(Packing::snorm16ToFloat(x), Packing::snorm16ToFloat(y), Packing::snorm16ToFloat(z));
+        }
+    };
+
+    /**
+     * @struct SNormVector4
+     * @brief Four signed normalized 16-bit values (8 bytes). For tangents with a
+     *        handedness sign in w, or quaternions.
+     */
+    struct
+        SNormVector4 {
+        std::int16_t x, y, z, w;
+
+        SNormVector4() : x(0), y(0), z(0), w(0) {}
+
+        explicit SNormVector4(const CVector4& v)
+            : x(Packing::floatToSnorm16(v.x)), y(Packing::floatToSnorm16(v.y)),
+              z(Packing::floatToSnorm16(v.z)), w(Packing::floatToSnorm16(v.w)) {}
+
+        CVector4
+            toCVector4() const {
+            return CVector4(Packing::snorm16ToFloat(x), Packing::snorm16ToFloat(y),
+                            Packing::snorm16ToFloat(z), Packing::snorm16ToFloat(w));
+        }
+    };
+
+    /**
+     * @struct UNormVector4
+     * @brief Four unsigned normalized 16-bit values in [0, 1] (8 bytes). For colours
+     *        and blend weights.
+     */
+    struct
+        UNormVector4 {
+        std::uint16_t x, y, z, w;
+
+        UNormVector4() : x(0), y(0), z(0), w(0) {}
+
+        explicit UNormVector4(const CVector4& v)
+            : x(Packing::floatToUnorm16(v.x)), y(Packing::floatToUnorm16(v.y)),
+              z(Packing::floatToUnorm16(v.z)), w(Packing::floatToUnorm16(v.w)) {}
+
+        CVector4
+            toCVector4() const {
+            return CVector4(Packing::unorm16ToFloat(x), Packing::unorm16ToFloat(y),
+                            Packing::unorm16ToFloat(z), Packing::unorm16ToFloat(w));
+        }
+    };
+
+    namespace Packing {
+
+        // Whole arrays at once: the vectors are tightly packed, so each call is one
+        // flat SIMD conversion over 3 or 4 values per element.
+
+        inline void pack(const CVector3* in, HalfVector3* out, int count) { floatToHalf(&in->x, &out->x, count * 3); }
+        inline void unpack(const HalfVector3* in, CVector3* out, int count) { halfToFloat(&in->x, &out->x, count * 3); }
+        inline void pack(const CVector4* in, HalfVector4* out, int count) { floatToHalf(&in->x, &out->x, count * 4); }
+        inline void unpack(const HalfVector4* in, CVector4* out, int count) { halfToFloat(&in->x, &out->x, count * 4); }
+
+        inline void pack(const CVector3* in, SNormVector3* out, int count) { floatToSnorm16(&in->x, &out->x, count * 3); }
+        inline void unpack(const SNormVector3* in, CVector3* out, int count) { snorm16ToFloat(&in->x, &out->x, count * 3); }
+        inline void pack(const CVector4* in, SNormVector4* out, int count) { floatToSnorm16(&in->x, &out->x, count * 4); }
+        inline void unpack(const SNormVector4* in, CVector4* out, int count) { snorm16ToFloat(&in->x, &out->x, count * 4); }
+
+        inline void pack(const CVector4* in, UNormVector4* out, int count) { floatToUnorm16(&in->x, &out->x, count * 4); }
+        inline void unpack(const UNormVector4* in, CVector4* out, int count) { unorm16ToFloat(&in->x, &out->x, count * 4); }
+
+    } // namespace Packing
+
+    static_assert(sizeof(HalfVector3) == 6 && sizeof(HalfVector4) == 8, "Packed vectors must have no padding");
+    static_assert(sizeof(SNormVector3) == 6 && sizeof(SNormVector4) == 8 && sizeof(UNormVector4) == 8,
+                  "Packed vectors must have no padding");
+
+} // namespace EU
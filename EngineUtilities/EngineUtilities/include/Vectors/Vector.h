@@ -0,0 +1,314 @@
+#pragma once
+
+#include <Core/SIMD.h>
+#include <Math/EngineMath.h>
+#include <Vectors/Vector2.h>
+#include <Vectors/Vector3.h>
+#include <Vectors/Vector4.h>
+
+/**
+ * @file Vector.h
+ * @brief Generic N-component vector for float, double and int.
+ *
+ * Component loops are unrolled at compile time. Vector<float, 4>, Vector<int, 4>
+ * and Vector<double, 2> do their arithmetic in one SIMD::float4 / int4 / double2
+ * register. CVector2/3/4 stay the float types used across the library;
+ * toVector/toCVector convert between them and Vector<float, N>.
+ */
+
+namespace EU {
+
+    namespace detail {
+
+        /**
+         * @brief Calls f(I), f(I + 1), ..., f(N - 1), expanded at compile time.
+         */
+        template<int I, int N>
+        struct
+            Unroll {
+            template<class F>
+            static void
+                apply(const F& f) {
+                f(I);
+                Unroll<I + 1, N>::apply(f);
+            }
+        };
+
+        template<int N>
+        struct
+            Unroll<N, N> {
+            template<class F>
+            static void
+                apply(const F&) {}
+        };
+
+        /**
+         * @brief Element-wise kernels on N contiguous values; specialized below for the
+         *        sizes that fill a SIMD register.
+         */
+        template<class T, int N>
+        struct
+            VectorOps {
+            static void add(const T* a, const T* b, T* r) { Unroll<0, N>::apply([&](int i) { r[i] = a[i] + b[i]; }); }
+            static void sub(const T* a, const T* b, T* r) { Unroll<0, N>::apply([&](int i) { r[i] = a[i] - b[i]; }); }
+            static void mul(const T* a, const T* b, T* r) { Unroll<0, N>::apply([&](int i) { r[i] = a[i] * b[i]; }); }
+            static void div(const T* a, const T* b, T* r) { Unroll<0, N>::apply([&](int i) { r[i] = a[i] / b[i]; }); }
+            static void scale(const T* a, T s, T* r) { Unroll<0, N>::apply([&](int i) { r[i] = a[i] * s; }); }
+
+            static T
+                dot(const T* a, const T* b) {
+                T sum = T(0);
+                Unroll<0, N>::apply([&](int i) { sum += a[i] * b[i]; });
+                return sum;
+            }
+        };
+
+        template<>
+        struct
+            VectorOps<float, 4> {
+            typedef SIMD::float4 R;
+            static void add(const float* a, const float* b, float* r) { (R::loadu(a) + R::loadu(b)).storeu(r); }
+            static void sub(const float* a, const float* b, float* r) { (R::loadu(a) - R::loadu(b)).storeu(r); }
+            static void mul(const float* a, const float* b, float* r) { (R::loadu(a) * R::loadu(b)).storeu(r); }
+            static void div(const float* a, const float* b, float* r) { (R::loadu(a) / R::loadu(b)).storeu(r); }
+            static void scale(const float* a, float s, float* r) { (R::loadu(a) * R(s)).storeu(r); }
+
+            static float
+                dot(const float* a, const float* b) {
+                alignas(16) float p[4];
+                (R::loadu(a) * R::loadu(b)).store(p);
+                return (p[0] + p[1]) + (p[2] + p[3]);
+            }
+        };
+
+        template<>
+        struct
+            VectorOps<int, 4> {
+            typedef SIMD::int4 R;
+            static void add(const int* a, const int* b, int* r) { (R::loadu(a) + R::loadu(b)).storeu(r); }
+            static void sub(const int* a, const int* b, int* r) { (R::loadu(a) - R::loadu(b)).storeu(r); }
+            static void mul(const int* a, const int* b, int* r) { (R::loadu(a) * R::loadu(b)).storeu(r); }
+            static void div(const int* a, const int* b, int* r) { for (int i = 0; i < 4; ++i) r[i] = a[i] / b[i]; }
+            static void scale(const int* a, int s, int* r) { (R::loadu(a) * R(s)).storeu(r); }
+
+            static int
+                dot(const int* a, const int* b) {
+                const R p = R::loadu(a) * R::loadu(b);
+                return (p.lane(0) + p.lane(1)) + (p.lane(2) + p.lane(3));
+            }
+        };
+
+        template<>
+        struct
+            VectorOps<double, 2> {
+            typedef SIMD::double2 R;
+            static void add(const double* a, const double* b, double* r) { (R::loadu(a) + R::loadu(b)).storeu(r); }
+            static void sub(const double* a, const double* b, double* r) { (R::loadu(a) - R::loadu(b)).storeu(r); }
+            static void mul(const double* a, const double* b, double* r) { (R::loadu(a) * R::loadu(b)).storeu(r); }
+            static void div(const double* a, const double* b, double* r) { (R::loadu(a) / R::loadu(b)).storeu(r); }
+            static void scale(const double* a, double s, double* r) { (R::loadu(a) * R(s)).storeu(r); }
+
+            static double
+                dot(const double* a, const double* b) {
+                return a[0] * b[0] + a[1] * b[1];
+            }
+        };
+
+        inline float
+            squareRoot(float x) {
+            return Math::sqrt(x);
+        }
+
+        inline double
+            squareRoot(double x) {
+            return SIMD::sqrt(SIMD::double2(x)).lane(0);
+        }
+
+    } // namespace detail
+
+    /**
+     * @class Vector
+     * @brief N components of type T.
+     */
+    template<class T, int N>
+    class
+        Vector {
+    public:
+        static_assert(N > 0, "Vector needs at least one component");
+
+        typedef detail::VectorOps<T, N> Ops;
+
+        T v[N];
+
+        /**
+         * @brief Default constructor. Initializes every component to 0.
+         */
+        Vector() : v{} {}
+
+        /**
+         * @brief Broadcasts s to every component.
+         */
+        explicit Vector(T s) {
+            detail::Unroll<0, N>::apply([&](int i) { v[i] = s; });
+        }
+
+        /**
+         * @brief One value per component, e.g. Vector<double, 3>(1.0, 2.0, 3.0).
+         */
+        template<class... Rest>
+        Vector(T first, T second, Rest... rest) : v{ first, second, static_cast<T>(rest)... } {
+            static_assert(sizeof...(Rest) + 2 == N, "Vector needs one value per component");
+        }
+
+        /**
+         * @brief Converts each component with static_cast.
+         */
+        template<class U>
+        explicit Vector(const Vector<U, N>& o) {
+            detail::Unroll<0, N>::apply([&](int i) { v[i] = static_cast<T>(o.v[i]); });
+        }
+
+        T&
+            operator[](int i) { return v[i]; }
+
+        const T&
+            operator[](int i) const { return v[i]; }
+
+        Vector
+            operator+(const Vector& o) const { Vector r; Ops::add(v, o.v, r.v); return r; }
+
+        Vector
+            operator-(const Vector& o) const { Vector r; Ops::sub(v, o.v, r.v); return r; }
+
+        /**
+         * @brief Component-wise product.
+         */
+        Vector
+            operator*(const Vector& o) const { Vector r; Ops::mul(v, o.v, r.v); return r; }
+
+        /**
+         * @brief Component-wise quotient.
+         */
+        Vector
+            operator/(const Vector& o) const { Vector r; Ops::div(v, o.v, r.v); return r; }
+
+        Vector
+            operator*(T s) const { Vector r; Ops::scale(v, s, r.v); return r; }
+
+        Vector
+            operator/(T s) const { return *this / Vector(s); }
+
+        Vector
+            operator-() const { Vector r; Ops::sub(Vector().v, v, r.v); return r; }
+
+        Vector&
+            operator+=(const Vector& o) { Ops::add(v, o.v, v); return *this; }
+
+        Vector&
+            operator-=(const Vector& o) { Ops::sub(v, o.v, v); return *this; }
+
+        Vector&
+            operator*=(T s) { Ops::scale(v, s, v); return *this; }
+
+        Vector&
+            operator/=(T s) { *this = *this / s; return *this; }
+
+        bool
+            operator==(const Vector& o) const {
+            bool same = true;
+            detail::Unroll<0, N>::apply([&](int i) { same = same && v[i] == o.v[i]; });
+            return same;
+        }
+
+        bool
+            operator!=(const Vector& o) const { return !(*this == o); }
+
+        T
+            dot(const Vector& o) const { return Ops::dot(v, o.v); }
+
+        T
+            lengthSquared() const { return Ops::dot(v, v); }
+
+        /**
+         * @brief Euclidean length (float and double only).
+         */
+        T
+            length() const { return detail::squareRoot(lengthSquared()); }
+
+        /**
+         * @brief Unit vector in the same direction, or zero for a zero vector
+         *        (float and double only).
+         */
+        Vector
+            normalized() const {
+            const T len = length();
+            return len > T(0) ? *this * (T(1) / len) : Vector();
+        }
+
+        static Vector
+            zero() { return Vector(); }
+    };
+
+    template<class T, int N>
+    inline Vector<T, N>
+        operator*(T s, const Vector<T, N>& a) {
+        return a * s;
+    }
+
+    template<class T>
+    inline Vector<T, 3>
+        cross(const Vector<T, 3>& a, const Vector<T, 3>& b) {
+        return Vector<T, 3>(a[1] * b[2] - a[2] * b[1],
+                            a[2] * b[0] - a[0] * b[2],
+                            a[0] * b[1] - a[1] * b[0]);
+    }
+
+    template<class T, int N>
+    inline Vector<T, N>
+        lerp(const Vector<T, N>& a, const Vector<T, N>& b, T t) {
+        return a + (b - a) * t;
+    }
+
+    typedef Vector<float, 2> Vector2f;
+    typedef Vector<float, 3> Vector3f;
+    typedef Vector<float, 4> Vector4f;
+    typedef Vector<double, 2> Vector2d;
+    typedef Vector<double, 3> Vector3d;
+    typedef Vector<double, 4> Vector4d;
+    typedef Vector<int, 2> Vector2i;
+    typedef Vector<int, 3> Vector3i;
+    typedef Vector<int, 4> Vector4i;
+
+    // Conversions with the float classes
+
+    inline Vector2f
+        toVector(const CVector2& v) {
+        return Vector2f(v.x, v.y);
+    }
+
+    inline Vector3f
+        toVector(const CVector3& v) {
+        return Vector3f(v.x, v.y, v.z);
+    }
+
+    inline Vector4f
+        toVector(const CVector4& v) {
+        return Vector4f(v.x, v.y, v.z, v.w);
+    }
+
+    inline CVector2
+        toCVector(const Vector2f& v) {
+        return CVector2(v[0], v[1]);
+    }
+
+    inline CVector3
+        toCVector(const Vector3f& v) {
+        return CVector3(v[0], v[1], v[2]);
+    }
+
+    inline CVector4
+        toCVector(const Vector4f& v) {
+        return CVector4(v[0], v[1], v[2], v[3]);
+    }
+
+} // namespace EU